@@ -0,0 +1,192 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Little-endian encoding helpers shared by the save file (SaveSystem.cpp)
+// and the save journal (SaveJournal.cpp).
+
+// Slicing-by-8 tables: values[0] is the classic byte table, values[k] is the
+// CRC of a byte followed by k zero bytes
+struct Crc32Table {
+    uint32_t values[8][256];
+
+    constexpr Crc32Table() : values() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            values[0][i] = c;
+        }
+        for (int t = 1; t < 8; t++) {
+            for (uint32_t i = 0; i < 256; i++) {
+                uint32_t prev = values[t - 1][i];
+                values[t][i] = (prev >> 8) ^ values[0][prev & 0xFF];
+            }
+        }
+    }
+};
+
+inline constexpr Crc32Table crcTable;
+
+inline uint32_t crc32(const char* data, std::size_t size) {
+    const uint8_t* p = (const uint8_t*)data;
+    const auto& t = crcTable.values;
+    uint32_t crc = 0xFFFFFFFFu;
+
+    // Eight bytes per step with independent lookups, instead of one byte
+    // per step with each lookup waiting on the last
+    while (size >= 8) {
+        uint32_t low = crc ^ ((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+        uint32_t high = (uint32_t)p[4] | ((uint32_t)p[5] << 8) | ((uint32_t)p[6] << 16) | ((uint32_t)p[7] << 24);
+        crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+              t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^ t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+        p += 8;
+        size -= 8;
+    }
+    while (size--) {
+        crc = t[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+class ByteWriter {
+private:
+    std::string& out;
+    std::size_t sectionStart;
+
+public:
+    explicit ByteWriter(std::string& buffer) : out(buffer), sectionStart(0) {}
+
+    void u8(uint8_t v) { out.push_back((char)v); }
+
+    void u16(uint16_t v) {
+        out.push_back((char)(v & 0xFF));
+        out.push_back((char)(v >> 8));
+    }
+
+    void u32(uint32_t v) {
+        for (int i = 0; i < 4; i++) out.push_back((char)((v >> (8 * i)) & 0xFF));
+    }
+
+    void i32(int v) { u32((uint32_t)v); }
+
+    void f32(float v) {
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        u32(bits);
+    }
+
+    void str(const std::string& v) {
+        u32((uint32_t)v.size());
+        out.append(v);
+    }
+
+    // A u32 length followed by the bytes; the length is patched in once
+    // the body is written. Sections and list records are both blocks.
+    std::size_t beginBlock() {
+        std::size_t start = out.size();
+        u32(0);
+        return start;
+    }
+
+    void endBlock(std::size_t start) {
+        patchU32(start, (uint32_t)(out.size() - start - 4));
+    }
+
+    template <typename Id>
+    void beginSection(Id id) {
+        u16((uint16_t)id);
+        sectionStart = beginBlock();
+    }
+
+    void endSection() { endBlock(sectionStart); }
+
+    void patchU32(std::size_t offset, uint32_t v) {
+        for (int i = 0; i < 4; i++) out[offset + i] = (char)((v >> (8 * i)) & 0xFF);
+    }
+};
+
+// Bounds-checked reader. A read past the end fails and leaves the
+// destination untouched, which is how appended fields get their defaults.
+class ByteReader {
+private:
+    const uint8_t* data;
+    std::size_t size;
+    std::size_t offset;
+
+public:
+    ByteReader(const char* bytes, std::size_t length)
+        : data((const uint8_t*)bytes), size(length), offset(0) {}
+
+    std::size_t remaining() const { return size - offset; }
+    const char* current() const { return (const char*)data + offset; }
+    void skip(std::size_t n) { offset += std::min(n, remaining()); }
+
+    bool u8(uint8_t& v) {
+        if (remaining() < 1) return false;
+        v = data[offset++];
+        return true;
+    }
+
+    bool u16(uint16_t& v) {
+        if (remaining() < 2) return false;
+        v = (uint16_t)(data[offset] | (data[offset + 1] << 8));
+        offset += 2;
+        return true;
+    }
+
+    bool u32(uint32_t& v) {
+        if (remaining() < 4) return false;
+        v = (uint32_t)data[offset] | ((uint32_t)data[offset + 1] << 8) |
+            ((uint32_t)data[offset + 2] << 16) | ((uint32_t)data[offset + 3] << 24);
+        offset += 4;
+        return true;
+    }
+
+    bool i32(int& v) {
+        uint32_t bits;
+        if (!u32(bits)) return false;
+        v = (int)bits;
+        return true;
+    }
+
+    bool f32(float& v) {
+        uint32_t bits;
+        if (!u32(bits)) return false;
+        std::memcpy(&v, &bits, sizeof(v));
+        return true;
+    }
+
+    // Splits off the next length-prefixed block as its own reader
+    bool block(ByteReader& inner) {
+        uint32_t length;
+        if (remaining() < 4) return false;
+        std::size_t start = offset;
+        u32(length);
+        if (remaining() < length) {
+            offset = start;
+            return false;
+        }
+        inner = ByteReader(current(), length);
+        offset += length;
+        return true;
+    }
+
+    bool str(std::string& v) {
+        uint32_t length;
+        if (remaining() < 4) return false;
+        std::size_t start = offset;
+        u32(length);
+        if (remaining() < length) {
+            offset = start;
+            return false;
+        }
+        v.assign(current(), length);
+        offset += length;
+        return true;
+    }
+};
@@ -31,12 +31,48 @@ namespace Config {
     constexpr float ENEMY_SPAWN_INTERVAL = 6.0f;
     constexpr int BASE_MAX_ENEMIES = 3;
     constexpr int MAX_ENEMY_CAP = 8;
+    constexpr float HIDDEN_ENEMY_AI_INTERVAL = 0.1f; // AI tick for enemies out of the player's view
+    constexpr const char* SPAWN_WEIGHTS_FILE = "assets/data/spawn_weights.cfg";
+
+    // Effects
+    constexpr int MAX_PARTICLES = 16384;
+    constexpr int MAX_DAMAGE_NUMBERS = 128;
+    constexpr int MAX_EFFECTS_PER_TYPE = 64;
+    constexpr int DECAL_CHUNK_SIZE = 512;   // Pixels per side of each decal render texture
+    constexpr int MAX_PENDING_DECALS = 64;  // Stamps queued between two frames
+
+    // Projectiles
+    constexpr int MAX_PROJECTILES = 16384;
+    constexpr int PROJECTILE_GRID_CELL = 64;         // Broadphase cell size in pixels
+    constexpr float PROJECTILE_MAX_RADIUS = 8.0f;
+    constexpr float PROJECTILE_LIFETIME = 3.0f;      // Seconds before an unspent projectile fizzles
+    constexpr float THROW_AUTO_AIM_RANGE = 400.0f;   // Thrown items home on the nearest visible enemy within this
 
     // Map
     constexpr int TILE_SIZE = 32;
     constexpr int MAP_WIDTH = 80;
     constexpr int MAP_HEIGHT = 50;
     constexpr int LEVELS_PER_FLOOR = 5; // New map every 5 levels
+    constexpr int FOV_RADIUS = 10; // Player sight radius in tiles
+    constexpr int BSP_MIN_REGION_SIZE = 7; // Smallest BSP region side, in tiles: a 5-tile room plus a wall each side
+    constexpr float DUNGEON_LOOP_CHANCE = 0.15f; // Chance to carve a corridor the spanning tree doesn't need
+    constexpr int CAVE_FLOOR_INTERVAL = 4; // Every 4th floor is a cave instead of rooms
+    constexpr int CAVE_INITIAL_WALLS = 7; // Initial cave wall density, in sixteenths
+    constexpr int CAVE_SMOOTHING_STEPS = 5;
+    constexpr int CAVE_MIN_REGION_TILES = 24; // Smaller cave pockets are filled in rather than tunnelled to
+    constexpr float CAVE_DECORATION_CHANCE = 0.04f; // Per open tile against a cave wall
+    constexpr int DISTANCE_FIELD_SUBDIVISIONS = 4; // Wall distance field cells per tile side
+    constexpr float SPAWN_MIN_WALL_CLEARANCE = 24.0f; // Pixels from a spawn point to the nearest wall
+    constexpr float SPAWN_MIN_PLAYER_DISTANCE = 256.0f; // Enemies never spawn closer than this to the player
+    constexpr int FLOOR_CACHE_SIZE = 4; // Floors kept in memory; older ones spill to FLOOR_CACHE_SPILL_FILE
+    constexpr const char* FLOOR_CACHE_SPILL_FILE = "saves/floorcache.tmp";
+    constexpr int FLOOR_CACHE_SPILL_BYTES = 64 * 1024 * 1024; // Spill file size that starts it over
+    constexpr int FLOOR_PREFETCH_LEVELS = 1; // Levels before a floor change at which the next floor starts building
+
+    // Lighting
+    constexpr int LIGHTMAP_TEXELS_PER_TILE = 2;
+    constexpr float AMBIENT_LIGHT = 0.35f;
+    constexpr int MAX_DYNAMIC_LIGHTS = 16;
 
     // Potion Effects
     constexpr int HEALTH_POTION_HEAL = 75;
@@ -56,8 +92,11 @@ namespace Config {
     constexpr float HOLY_WATER_OF_LIFE_DROP_RATE = 0.03f;
 
     // Save System
-    constexpr const char* SAVE_FILE = "saves/savegame.json";
-    constexpr const char* BACKUP_SAVE_FILE = "saves/savegame_backup.json";
+    constexpr const char* SAVE_FILE_STEM = "saves/savegame";  // Slot N adds "_slotN"; see SaveSystem::getSlotFiles
+    constexpr const char* SAVE_INDEX_FILE = "saves/index.dat";
+    constexpr int MAX_SAVE_SLOTS = 32;
+    constexpr float AUTOSAVE_INTERVAL = 300.0f;  // Seconds between full snapshots; the journal covers events in between
+    constexpr int SAVE_JOURNAL_COMPACT_BYTES = 16 * 1024;  // Journal size that triggers an early snapshot
 
     // Audio
     constexpr float MASTER_VOLUME = 0.7f;
@@ -3,16 +3,29 @@
 #include "Player.h"
 #include "Enemy.h"
 #include "MapGenerator.h"
+#include "FloorCache.h"
+#include "FloorPrefetcher.h"
 #include "ParticleSystem.h"
 #include "SoundManager.h"
 #include "HUD.h"
 #include "SaveSystem.h"
+#include "SaveWorker.h"
+#include "SaveJournal.h"
 #include "MainMenu.h"
 #include "EffectSystem.h"
 #include "CompanionSystem.h"
+#include "SpawnTable.h"
+#include "FieldOfView.h"
+#include "LightingSystem.h"
+#include "DecalSystem.h"
+#include "ProjectileSystem.h"
+#include "Config.h"
 #include <vector>
+#include <array>
 #include <memory>
 #include <random>
+#include <string_view>
+#include <cstdint>
 
 struct DamageNumber {
     Vector2 position;
@@ -20,6 +33,7 @@ struct DamageNumber {
     float timeLeft;
     Color color;
 
+    DamageNumber() : position({0, 0}), damage(0), timeLeft(0), color(BLANK) {}
     DamageNumber(Vector2 pos, int dmg, Color col)
         : position(pos), damage(dmg), timeLeft(1.0f), color(col) {}
 };
@@ -32,13 +46,20 @@ private:
     bool gameOver;
     float gameTime;
     int currentFloor;
+    uint32_t runSeed;  // Every floor's layout derives from this, see floorSeedFor
 
     // Game objects
     std::unique_ptr<Player> player;
     std::unique_ptr<MapGenerator> gameMap;
+    FloorCache floorCache;  // Outlives gameMap, so a restart after death reuses its floors
+    FloorPrefetcher floorPrefetcher;
+    FieldOfView fieldOfView;
+    LightingSystem lighting;
     std::vector<std::unique_ptr<Enemy>> enemies;
     ParticleSystem particleSystem;
     EffectSystem effectSystem;
+    ProjectileSystem projectiles;
+    DecalSystem decals;
     SoundManager soundManager;
     CompanionSystem companionSystem;
     std::unique_ptr<HUD> hud;
@@ -57,15 +78,30 @@ private:
 
     // Enemy spawning
     std::mt19937 rng;
+    SpawnTable spawnTable;
     float enemySpawnTimer;
     int maxEnemies;
 
     // Visual effects
-    std::vector<DamageNumber> damageNumbers;
+    // Damage numbers all share one lifetime, so the oldest is always at the head
+    std::array<DamageNumber, Config::MAX_DAMAGE_NUMBERS> damageNumbers;
+    int damageNumberHead;
+    int damageNumberCount;
     float attackFlashTimer;
+    bool showDebugOverlay;
+    bool showDistanceField;
 
     // Save system
+    int saveSlot;
+    SaveSlotFiles slotFiles;
     SaveData saveData;
+    SaveWorker saveWorker;
+    SaveJournal journal;
+    float autosaveTimer;
+    bool autosavePending;  // Set by floor changes and a full journal
+    int journaledLevel;
+    unsigned int journaledInventoryVersion;
+    std::vector<InventoryItem> journaledInventory;  // Inventory as of the last journal entry
 
 public:
     Game();
@@ -82,30 +118,47 @@ private:
     void handleSpells();
 
     void updatePlayer(float deltaTime);
+    void updateFieldOfView();
+    void knockBackEnemy(Enemy& enemy, Vector2 from, float force);
     void updateEnemies(float deltaTime);
+    void updateProjectiles(float deltaTime);
     void updateCamera();
     void updateDamageNumbers(float deltaTime);
     void updateParticles(float deltaTime);
 
     void checkPlayerAttack();
+    void onEnemyKilled(Enemy& enemy);
+    bool throwItem(std::string_view itemName);
     void checkCollisions();
     void removeDeadEnemies();
     void spawnEnemies();
     void generateNewFloor();
+    void buildFloor(int floor, uint32_t seed);
 
     void castFireball();
     void castFrostWave();
     void castChainLightning();
     void castWhirlwind();
 
+    void addDamageNumber(Vector2 position, int damage, Color color);
+    void clearDamageNumbers();
     void drawDamageNumbers();
     void generateItemDrops(Enemy* enemy);
     void drawCompanionInfo();
     void drawGameOver();
     void drawPauseMenu();
+    void drawDebugOverlay();
+    void drawDistanceField(Rectangle view);
 
     void saveGame();
-    void loadGame();
+    bool readSaveData();
+    void applySaveData();
+    uint32_t floorSeedFor(int floor) const;
+    bool hasSaveFile() const;
+    void setSaveSlot(int slot);
+    void requestAutosave() { autosavePending = true; }
+    void updateAutosave(float deltaTime);
+    void journalInventoryChanges();
 
     // Utility
     EnemyType selectEnemyType(int playerLevel);
@@ -123,8 +176,10 @@ public:
     int getCurrentFloor() const { return currentFloor; }
     const std::vector<std::unique_ptr<Enemy>>& getEnemies() const { return enemies; }
     MapGenerator* getMap() const { return gameMap.get(); }
+    const FieldOfView& getFieldOfView() const { return fieldOfView; }
     Player* getPlayer() const { return player.get(); }
     CompanionSystem& getCompanionSystem() { return companionSystem; }
+    const SaveWorker& getSaveWorker() const { return saveWorker; }
     bool getInventoryOpen() const { return inventoryOpen; }
     void setInventoryOpen(bool open) { inventoryOpen = open; }
 };
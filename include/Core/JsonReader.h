@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+enum class JsonToken : uint8_t {
+    BEGIN_OBJECT,
+    END_OBJECT,
+    BEGIN_ARRAY,
+    END_ARRAY,
+    KEY,
+    STRING,
+    NUMBER,
+    TRUE_VALUE,
+    FALSE_VALUE,
+    NULL_VALUE,
+    END,    // The whole document has been read
+    ERROR   // Malformed input, see getError(); every later call returns ERROR too
+};
+
+// Pull-style JSON reader over a memory buffer. Each next() call returns one
+// token, and the reader itself never allocates. Token text is a view into
+// the buffer, and strings are only unescaped when the caller copies them out
+// with getString(). The caller decides what each key means and calls
+// skipValue() for keys it doesn't know, so one pass handles any layout.
+class JsonReader {
+private:
+    enum class Expect : uint8_t {
+        VALUE,
+        KEY,
+        KEY_OR_CLOSE,    // Just after '{'
+        VALUE_OR_CLOSE,  // Just after '['
+        SEPARATOR        // After a complete value: ',' or the closing bracket
+    };
+
+    static constexpr int MAX_DEPTH = 32;
+
+    const char* begin;
+    const char* pos;
+    const char* end;
+    std::string_view text;
+    bool textEscaped;
+    Expect expect;
+    int depth;
+    bool inObject[MAX_DEPTH];
+    const char* error;
+
+    JsonToken fail(const char* message);
+    JsonToken readValue();
+    JsonToken close(char bracket);
+    bool scanString();
+    bool scanNumber();
+    bool scanLiteral(std::string_view literal);
+    void skipWhitespace();
+
+public:
+    JsonReader(const char* data, std::size_t size);
+
+    JsonToken next();
+
+    // Text of the last KEY, STRING or NUMBER token. Strings exclude the quotes
+    // and may still contain escapes; use getString() to decode them.
+    std::string_view getText() const { return text; }
+    bool getString(std::string& out) const;
+    bool getInt(int& out) const;
+    bool getFloat(float& out) const;
+
+    // Skips the rest of the value whose first token was just returned, so
+    // after a BEGIN_OBJECT or BEGIN_ARRAY it consumes the whole container
+    bool skipContainer(JsonToken first);
+    // Reads and discards the next value, typically for an unknown key
+    bool skipValue() { return skipContainer(next()); }
+
+    // Typed reads of the next value. On a type mismatch the value is skipped,
+    // the destination is left unchanged and false is returned.
+    bool readString(std::string& out);
+    bool readInt(int& out);
+    bool readFloat(float& out);
+
+    int getDepth() const { return depth; }
+    const char* getError() const { return error; }
+    int getLine() const;  // 1-based line of the current position, for error messages
+};
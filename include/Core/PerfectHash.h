@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Compile-time perfect hash over the names of a static table.
+// buildPerfectHash() searches for a seed under which every key lands in its own
+// slot, so a lookup is one hash, one probe and one string compare.
+template <std::size_t TableSize>
+struct PerfectHash {
+    static_assert((TableSize & (TableSize - 1)) == 0, "TableSize must be a power of two");
+
+    static constexpr std::uint8_t EMPTY = 0xFF;
+
+    std::uint32_t seed = 0;
+    std::uint8_t slots[TableSize] = {};
+
+    static constexpr std::uint32_t hash(std::string_view key, std::uint32_t seed) {
+        // FNV-1a with a final mix so the low bits depend on the whole key
+        std::uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+        for (char c : key) {
+            h ^= static_cast<std::uint8_t>(c);
+            h *= 16777619u;
+        }
+        h ^= h >> 15;
+        h *= 0x2C1B3C6Du;
+        h ^= h >> 12;
+        return h;
+    }
+
+    // Returns the table index stored for this key's slot, or EMPTY.
+    // Callers must still compare the name, since unknown keys can hit a used slot.
+    constexpr std::uint8_t find(std::string_view key) const {
+        return slots[hash(key, seed) & (TableSize - 1)];
+    }
+};
+
+template <std::size_t TableSize, typename T, std::size_t N>
+constexpr PerfectHash<TableSize> buildPerfectHash(const T (&table)[N], std::string_view T::*key) {
+    static_assert(N <= TableSize, "Table has more keys than hash slots");
+    static_assert(N < PerfectHash<TableSize>::EMPTY, "Table too large for 8-bit slots");
+
+    PerfectHash<TableSize> result{};
+    for (std::uint32_t seed = 0;; seed++) {
+        for (auto& slot : result.slots) slot = PerfectHash<TableSize>::EMPTY;
+
+        bool collision = false;
+        for (std::size_t i = 0; i < N && !collision; i++) {
+            std::size_t slot = PerfectHash<TableSize>::hash(table[i].*key, seed) & (TableSize - 1);
+            if (result.slots[slot] != PerfectHash<TableSize>::EMPTY) {
+                collision = true;
+            } else {
+                result.slots[slot] = static_cast<std::uint8_t>(i);
+            }
+        }
+
+        if (!collision) {
+            result.seed = seed;
+            return result;
+        }
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "SaveSystem.h"
+#include <cstdio>
+#include <cstdint>
+#include <string>
+
+enum class JournalEvent : uint8_t {
+    KILL = 1,   // Enemy type, score, kill count, experience, snapshot index, position
+    LEVEL = 2,  // Level and experience after a level-up
+    ITEM = 3,   // Item name and its new quantity, 0 when it left the inventory
+    FLOOR = 4   // Floor number, seed, layout checksum, player spawn position
+};
+
+// Append-only log of game events between full saves. Each event is a few
+// dozen bytes appended and flushed, instead of a whole snapshot rewrite.
+// Saving a snapshot compacts the journal: the snapshot gets the next epoch,
+// the current journal is kept as the previous one and a fresh journal for
+// the new epoch is started. Loading replays whichever journals continue
+// from the snapshot that was actually read. Appends are flushed but not
+// synced, so a game crash loses nothing; a power cut can lose the last few.
+//
+// File layout: "DC2J" magic, u16 version, u16 reserved, u32 epoch, then
+// records of {u8 event, u16 length, payload, u32 CRC-32 of the preceding
+// bytes}. Replay stops at the first truncated or damaged record.
+class SaveJournal {
+private:
+    std::FILE* file;
+    std::string filename;
+    std::string previousFilename;
+    uint32_t epoch;
+    std::size_t size;
+    std::string record;  // Scratch buffer, reused by every append
+
+    std::string& beginRecord(JournalEvent event);
+    void endRecord();
+
+public:
+    SaveJournal();
+    ~SaveJournal();
+
+    SaveJournal(const SaveJournal&) = delete;
+    SaveJournal& operator=(const SaveJournal&) = delete;
+
+    // Starts the journal for the snapshot with this epoch; the current one
+    // becomes the previous journal until that snapshot is on disk
+    bool rotate(uint32_t snapshotEpoch);
+    void setFiles(const std::string& journalFile, const std::string& previousJournalFile);  // Closes the journal
+    void close();
+    bool deleteFiles();
+
+    // snapshotIndex is the enemy's place in the snapshot's enemy list, -1 if
+    // it spawned after the snapshot
+    void recordKill(int enemyType, int snapshotIndex, float x, float y, int score, int enemiesKilled, int experience);
+    void recordLevel(int level, int experience);
+    void recordItem(const std::string& name, int quantity);
+    void recordFloor(int floor, uint32_t floorSeed, uint32_t layoutChecksum, float playerX, float playerY);
+
+    bool isOpen() const { return file != nullptr; }
+    std::size_t getSize() const { return size; }
+    uint32_t getEpoch() const { return epoch; }
+
+    // Applies the journals that continue from data.journalEpoch and advances
+    // it to the last epoch applied. Returns the number of events replayed.
+    static int replay(SaveData& data, const std::string& journalFile, const std::string& previousJournalFile);
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <string>
 #include <vector>
+#include <cstddef>
+#include <cstdint>
 
 // Potion inventory
 struct PotionInventory {
@@ -11,20 +13,47 @@ struct PotionInventory {
     int manaPotions = 0;
 };
 
-// Save data structure (matches JSON format)
+struct SavedItem {
+    std::string name;
+    int quantity = 0;
+};
+
+struct SavedSpell {
+    int type = 0;             // SpellType
+    float sinceCast = 0;      // Seconds since last cast, counts up to the cooldown
+};
+
+struct SavedEnemy {
+    int type = 0;             // EnemyType
+    int level = 1;
+    int health = 0;
+    float x = 0;
+    float y = 0;
+};
+
+struct SavedCompanion {
+    int type = 0;             // CompanionType, NONE when there is no companion
+    int level = 1;
+    int health = 0;
+    float x = 0;
+    float y = 0;
+};
+
+// Save data structure. Stored on disk in the binary format described in
+// SaveSystem.cpp; the JSON form is an export for the web dashboard.
 struct SaveData {
     // Player stats
     std::string playerName;  // ← ADD THIS
-    int playerLevel;
-    int playerHealth;
-    int playerMaxHealth;
-    int playerExperience;
+    int playerLevel = 1;
+    int playerHealth = 0;
+    int playerMaxHealth = 0;
+    int playerExperience = 0;
 
     // Game progress
-    int score;
-    int enemiesKilled;
-    int currentFloor; // Map changes every 5 levels
-    float playTime; // In seconds
+    int score = 0;
+    int enemiesKilled = 0;
+    int currentFloor = 1; // Map changes every 5 levels
+    float playTime = 0; // In seconds
 
     // Equipment
     std::string currentWeapon = "Valyrion Sword";
@@ -33,25 +62,86 @@ struct SaveData {
     PotionInventory potions;
 
     // Statistics
-    int totalDamageDealt;
-    int totalDamageTaken;
-    int potionsUsed;
-    int highestFloor;
+    int totalDamageDealt = 0;
+    int totalDamageTaken = 0;
+    int potionsUsed = 0;
+    int highestFloor = 1;
+
+    // Fog of war: explored-tile bitset (hex) for exploredFloor
+    int exploredFloor = 0;
+    std::string exploredTiles;
 
     // Timestamp
     std::string lastSaveTime;
 
+    // Full run state. Saves from before these sections existed load with
+    // hasRunState false and only restore the fields above.
+    bool hasRunState = false;
+    uint32_t runSeed = 0;
+    uint32_t floorSeed = 0;
+    uint32_t layoutChecksum = 0;  // MapGenerator::getLayoutChecksum of the saved floor
+    float playerX = 0;
+    float playerY = 0;
+    uint32_t journalEpoch = 0;  // Which save journal continues from this snapshot, see SaveJournal
+    std::vector<SavedItem> inventory;
+    std::vector<int> equippedItems;  // ItemType
+    std::vector<SavedSpell> spells;
+    float speedBuffTime = 0;
+    float stealthBuffTime = 0;
+    float rageBuffTime = 0;
+    std::vector<SavedEnemy> enemies;
+    SavedCompanion companion;
+
     // Methods
-    void toJSON(const std::string& filename) const;
-    bool fromJSON(const std::string& filename);
+    void writeBinary(std::string& out) const;
+    bool readBinary(const char* data, std::size_t size);
+    std::string toJSON() const;
+    bool fromJSON(const std::string& filename);  // Legacy text saves and the JSON export
+    // One pass over an in-memory JSON document; on failure, error gets "line: message"
+    bool parseJSON(const char* data, std::size_t size, std::string* error = nullptr);
+};
+
+// Every file belonging to one save slot
+struct SaveSlotFiles {
+    std::string save;
+    std::string backup;           // Previous save, kept by SaveSystem::save
+    std::string exportJSON;       // Read by the web dashboard
+    std::string journal;          // See SaveJournal
+    std::string previousJournal;  // Kept until the next snapshot lands
+};
+
+// What the load menu shows for a slot. Stored as a fixed-size record at the
+// start of every save and again in the slot index, so listing saves never
+// parses a full save file.
+struct SaveSummary {
+    int slot = -1;
+    std::string playerName;
+    int level = 1;
+    int floor = 1;
+    float playTime = 0;
+    int64_t savedAt = 0;  // Unix time
 };
 
 class SaveSystem {
 public:
-    static bool save(const SaveData& data, const std::string& filename);
-    static bool load(SaveData& data, const std::string& filename);
+    // Writes via a temp file and rename; a valid previous save becomes the backup
+    static bool save(const SaveData& data, const std::string& filename, const std::string& backupFilename);
+    // Falls back to the backup if the save is missing or fails its checksum
+    static bool load(SaveData& data, const std::string& filename, const std::string& backupFilename);
+    static bool exportJSON(const SaveData& data, const std::string& filename);
     static bool saveExists(const std::string& filename);
-    static std::vector<std::string> getAllSaves();
     static std::string getCurrentTimestamp();  // ← ADD THIS LINE
     static bool deleteSave(const std::string& filename);
+
+    // Save slots. Slot 0 uses the original single-save file names.
+    static SaveSlotFiles getSlotFiles(int slot);
+    static bool slotExists(int slot);
+    // Writes the slot's save and JSON export, then its index entry
+    static bool saveSlot(const SaveData& data, int slot);
+    static bool deleteSave(int slot);  // All of the slot's files and its index entry
+    // Reads only the fixed-size summary at the start of a save
+    static bool readSummary(const std::string& filename, SaveSummary& summary);
+    // Every slot from the index file, most recently saved first. A missing or
+    // damaged index is rebuilt from the save headers.
+    static std::vector<SaveSummary> getAllSaves();
 };
\ No newline at end of file
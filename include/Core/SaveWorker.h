@@ -0,0 +1,48 @@
+#pragma once
+#include "SaveSystem.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Writes saves on a background thread. The game hands over a SaveData
+// snapshot, which is cheap to copy, and serialization, the checksum and the
+// disk flush all happen off the render thread. Requests made while a write
+// is in flight coalesce, so only the newest snapshot is written next.
+class SaveWorker {
+private:
+    struct SaveRequest {
+        SaveData data;
+        int slot = 0;
+    };
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+
+    SaveRequest pending;
+    bool hasPending;
+    bool writing;
+    bool stopping;
+
+    std::atomic<bool> busy;
+    std::atomic<bool> lastSaveFailed;
+    std::atomic<long long> lastSaveFinishedAt;  // steady_clock ticks, 0 before the first save
+
+    void run();
+
+public:
+    SaveWorker();
+    ~SaveWorker();
+
+    SaveWorker(const SaveWorker&) = delete;
+    SaveWorker& operator=(const SaveWorker&) = delete;
+
+    void request(SaveData snapshot, int slot);
+    void waitIdle();  // Blocks until every requested save is on disk
+
+    bool isSaving() const { return busy; }
+    bool getLastSaveFailed() const { return lastSaveFailed; }
+    float getSecondsSinceLastSave() const;  // Negative before the first save finishes
+};
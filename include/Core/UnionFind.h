@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Disjoint sets over the indices 0..n-1, with union by size and path
+// halving, so any sequence of operations is effectively linear.
+class UnionFind {
+private:
+    std::vector<int> parent;
+    std::vector<int> size;
+    int sets;
+
+public:
+    explicit UnionFind(int count = 0) { reset(count); }
+
+    void reset(int count) {
+        parent.resize(count);
+        size.assign(count, 1);
+        for (int i = 0; i < count; i++) parent[i] = i;
+        sets = count;
+    }
+
+    int find(int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    }
+
+    // Returns false if the two were already in the same set
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (size[a] < size[b]) std::swap(a, b);
+        parent[b] = a;
+        size[a] += size[b];
+        sets--;
+        return true;
+    }
+
+    int getSetSize(int i) { return size[find(i)]; }
+    int getSetCount() const { return sets; }
+};
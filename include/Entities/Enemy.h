@@ -16,6 +16,9 @@ enum class EnemyType {
     DRAGON, TITAN, SKELETON_KING, GOBLIN_MAMA, FROST_KING, ABYSSAL_HYDRA, NECROMANCER,
 };
 
+class MapGenerator;
+class ProjectileSystem;
+
 enum class EnemyTier { D, C, B, A, S };
 enum class AIState { IDLE, CHASING, ATTACKING };
 
@@ -35,9 +38,27 @@ protected:
     Character* target;
     AIState currentState;
 
+    // Visibility: enemies the player can't see think less often
+    bool inPlayerView;
+    float hiddenAiTimer;
+
+    // Line of sight to the target, cached until either end changes tile
+    const MapGenerator* map;
+    int losFromTile;
+    int losToTile;
+    unsigned int losMapGeneration;
+    bool losClear;
+
+    // Ranged attackers fire through this; without it they hit instantly
+    ProjectileSystem* projectiles;
+
     // Visual effects
     float hitFlashTime;
     Color displayColor;
+    int nameLabelId;
+
+    // Position in the last save snapshot's enemy list, -1 if spawned since
+    int snapshotIndex;
 
 public:
     Enemy(EnemyType type, int hp, int lvl, const std::string& spritePath,
@@ -57,12 +78,20 @@ public:
     bool canAttack() const;
     void applyKnockback(Vector2 from, float force);
     void flashHit(float duration = 0.1f);
+    bool fireAtTarget(int damage, float speed, float radius, Color color);
 
     // Getters
     EnemyType getEnemyType() const { return enemyType; }
     EnemyTier getTier() const { return tier; }
     int getAttackDamage() const { return attackDamage; }
     void setTarget(Character* t) { target = t; }
+    void setInPlayerView(bool visible) { inPlayerView = visible; }
+    void setMap(const MapGenerator* m) { map = m; }
+    void setProjectiles(ProjectileSystem* p) { projectiles = p; }
+    bool hasLineOfSightToTarget();
+    bool isInPlayerView() const { return inPlayerView; }
+    int getSnapshotIndex() const { return snapshotIndex; }
+    void setSnapshotIndex(int index) { snapshotIndex = index; }
 
     // Factory methods for each enemy type
     static std::unique_ptr<Enemy> create(EnemyType type, int playerLevel);
@@ -275,6 +304,7 @@ class Witch : public Enemy {
 public:
     Witch(int playerLevel);
     void updateAI(float deltaTime) override;
+    void performAttack() override;
 };
 
 // Tier S
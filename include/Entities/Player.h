@@ -2,14 +2,9 @@
 #include "Character.h"
 #include <vector>
 #include <memory>
+#include <string_view>
 #include "ItemSystem.h"
-
-enum class WeaponType {
-    WOODEN_SWORD,
-    IRON_KATANA,
-    STEEL_DAGGER,
-    SHURIKEN,
-};
+#include "WeaponSystem.h"
 
 enum class SpellType {
     NONE,
@@ -62,6 +57,7 @@ private:
 
     // Inventory
     std::vector<InventoryItem> inventory;
+    unsigned int inventoryVersion;  // Bumped on every inventory change
     int maxInventorySize;
     std::vector<ItemType> equippedItems;
     float shieldDuration;
@@ -101,14 +97,17 @@ public:
     void castSpell(SpellType type);
     bool canCast(SpellType type) const;
     void gainExperience(int amount);
+    void restoreProgress(int lvl, int exp);  // Level-derived stats and spells, for loading
+    void setSpellCooldownElapsed(SpellType type, float elapsed);
 
     // Movement
     void handleInput();
 
     // Inventory
-    void addItem(const std::string& itemName, int quantity = 1);
-    bool useItem(const std::string& itemName);
-    bool hasItem(const std::string& itemName) const;
+    void addItem(std::string_view itemName, int quantity = 1);
+    bool useItem(std::string_view itemName);
+    bool hasItem(std::string_view itemName) const;
+    void setInventory(std::vector<InventoryItem> items);
 
     // Buffs
     void applySpeedBuff(float duration);
@@ -122,8 +121,11 @@ public:
     const Weapon& getWeapon() const { return currentWeapon; }
     const std::vector<Spell>& getSpells() const { return spells; }
     const std::vector<InventoryItem>& getInventory() const { return inventory; }
+    const std::vector<ItemType>& getEquippedItems() const { return equippedItems; }
+    unsigned int getInventoryVersion() const { return inventoryVersion; }
     bool getIsStealthed() const { return isStealthed; }
     float getSpeedBuffTime() const { return speedBuffTime; }
+    float getStealthBuffTime() const { return stealthBuffTime; }
     float getRageBuffTime() const { return rageBuffTime; }
     int getAttackDamage() const { return attackDamage; }
     float getCritChance() const { return critChance; }
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Cellular-automaton caves over a bit-packed grid, one bit per tile (1 =
+// wall), 64 tiles per word. A smoothing step turns a tile into wall when at
+// least 5 of the 9 tiles around and including it are walls; the counts for a
+// whole word come from a handful of shifts and adds on bitplanes, so a step
+// costs a few dozen operations per 64 tiles. Outside the grid counts as wall.
+//
+// After smoothing, open regions are labelled by union-find over horizontal
+// runs. Pockets under CAVE_MIN_REGION_TILES are filled in; every other region
+// is tunnelled to the largest one along a flood fill outward from it.
+class CaveGenerator {
+private:
+    struct Run {
+        int y;
+        int x0, x1;  // [x0, x1)
+    };
+
+    int width;
+    int height;
+    int wordsPerRow;
+    std::vector<uint64_t> walls;
+    std::vector<uint64_t> next;
+    std::vector<uint64_t> sumLow;   // Bit 0 of each tile's horizontal 3-sum
+    std::vector<uint64_t> sumHigh;  // Bit 1
+    std::vector<Run> runs;
+    std::vector<int> rowStart;      // First run of each row, plus an end marker
+    int regionCount;
+    int linkedCount;
+
+    uint64_t paddingMask() const;   // Bits past the right edge in a row's last word
+    void setWall(int x, int y, bool wall);
+    void sealBorder(std::vector<uint64_t>& grid) const;
+    void findRuns();
+
+public:
+    CaveGenerator(int gridWidth, int gridHeight);
+
+    void generate(std::mt19937& rng, int smoothingSteps);
+
+    // The steps generate() runs, in order; separate so tools/cave_check can
+    // compare each smoothing step against a plain 9-cell count
+    void randomFill(std::mt19937& rng);
+    void smooth();
+    void connectRegions();
+
+    bool isWall(int x, int y) const {
+        if (x < 0 || x >= width || y < 0 || y >= height) return true;
+        return (walls[(size_t)y * wordsPerRow + (x >> 6)] >> (x & 63)) & 1u;
+    }
+
+    int getRegionCount() const { return regionCount; }  // Open regions before linking
+    int getLinkedCount() const { return linkedCount; }  // Regions tunnelled to the main one
+};
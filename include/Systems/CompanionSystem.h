@@ -36,6 +36,9 @@ public:
     Vector2 getPosition() const { return position; }
     bool getIsAlive() const { return isAlive; }
     std::string getName() const;
+
+    void setHealth(int hp) { health = hp < maxHealth ? hp : maxHealth; isAlive = health > 0; }
+    void setPosition(Vector2 pos) { position = pos; }
 };
 
 class CompanionSystem {
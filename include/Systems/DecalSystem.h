@@ -0,0 +1,55 @@
+#pragma once
+#include "raylib.h"
+#include "Config.h"
+#include <array>
+#include <vector>
+#include <cstdint>
+
+class MapGenerator;
+
+enum class DecalType {
+    BLOOD,
+    SCORCH,
+    FROST
+};
+
+// Persistent floor marks. Stamps are queued at hit time and painted once
+// into chunked render textures covering the floor, so drawing costs one blit
+// per on-screen chunk however many marks have accumulated.
+class DecalSystem {
+private:
+    struct PendingDecal {
+        DecalType type;
+        Vector2 position;
+        float size;
+        uint32_t seed;
+    };
+
+    int chunksX;
+    int chunksY;
+    std::vector<RenderTexture2D> chunks;  // id 0 until something is stamped there
+
+    std::array<PendingDecal, Config::MAX_PENDING_DECALS> pending;
+    int pendingCount;
+    bool clearRequested;
+    uint32_t rngState;
+
+    void paint(const PendingDecal& decal, Vector2 offset);
+
+public:
+    DecalSystem();
+    ~DecalSystem();
+
+    DecalSystem(const DecalSystem&) = delete;
+    DecalSystem& operator=(const DecalSystem&) = delete;
+
+    void stamp(DecalType type, Vector2 position, float size);
+    void clear();
+
+    // Paints queued stamps; call outside BeginMode2D (texture mode resets the camera)
+    void flush(const MapGenerator& map);
+    void draw(Rectangle view) const;
+    void unload();
+
+    int getAllocatedChunkCount() const;
+};
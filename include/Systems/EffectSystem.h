@@ -1,6 +1,9 @@
 #pragma once
 #include "raylib.h"
-#include <vector>
+#include "Config.h"
+#include <array>
+
+class LightingSystem;
 
 enum class EffectType {
     FIREBALL,
@@ -9,22 +12,43 @@ enum class EffectType {
     WHIRLWIND_SPIN,
     SPELL_CAST_READY,  // ADD THESE
     SHIELD_ACTIVATE,
-    ITEM_THROW
+    ITEM_THROW,
+
+    COUNT
 };
+
 struct Effect {
     Vector2 position;
-    EffectType type;
+    Vector2 target;    // End point for CHAIN_LIGHTNING / ITEM_THROW
     float timeLeft;
     float duration;
     float size;
 
-    Effect(Vector2 pos, EffectType t, float dur, float sz)
-        : position(pos), type(t), timeLeft(dur), duration(dur), size(sz) {}
+    Effect() : position({0, 0}), target({0, 0}), timeLeft(0), duration(1), size(0) {}
+    Effect(Vector2 pos, Vector2 to, float dur, float sz)
+        : position(pos), target(to), timeLeft(dur), duration(dur), size(sz) {}
 };
 
+// One fixed-capacity pool per EffectType, so each type is drawn in a single
+// pass with no per-effect switch, and the per-frame cost is bounded.
 class EffectSystem {
 private:
-    std::vector<Effect> effects;
+    struct EffectPool {
+        std::array<Effect, Config::MAX_EFFECTS_PER_TYPE> effects;
+        int count = 0;
+    };
+
+    std::array<EffectPool, (std::size_t)EffectType::COUNT> pools;
+
+    void add(EffectType type, Vector2 from, Vector2 to, float duration, float size);
+
+    void drawFireballs(const EffectPool& pool);
+    void drawFrostWaves(const EffectPool& pool);
+    void drawChainLightning(const EffectPool& pool);
+    void drawWhirlwinds(const EffectPool& pool);
+    void drawSpellCastReady(const EffectPool& pool);
+    void drawShieldActivate(const EffectPool& pool);
+    void drawItemThrows(const EffectPool& pool);
 
 public:
     void addFireball(Vector2 position);
@@ -37,5 +61,8 @@ public:
 
     void update(float deltaTime);
     void draw();
+    void addLights(LightingSystem& lighting) const;
     void clear();
+
+    int getEffectCount() const;
 };
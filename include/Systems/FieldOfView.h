@@ -0,0 +1,57 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+class MapGenerator;
+
+// Player field of view on the tile grid, computed with recursive
+// shadowcasting. Visible and explored tiles are kept as bitsets; the visible
+// set is only recomputed when the player moves to another tile, and the
+// explored set lives for the whole floor (and is stored in the save).
+class FieldOfView {
+private:
+    int mapWidth;
+    int mapHeight;
+    int tileSize;
+    unsigned int mapGeneration;
+
+    std::vector<uint64_t> visible;
+    std::vector<uint64_t> explored;
+    unsigned int exploredVersion;  // Bumped whenever a tile becomes explored
+
+    int originX;
+    int originY;
+    bool valid;
+
+    void reset(const MapGenerator& map);
+    void compute(const MapGenerator& map);
+    void castLight(const MapGenerator& map, int row, float startSlope, float endSlope,
+                   int xx, int xy, int yx, int yy);
+    void markVisible(int x, int y);
+
+    static bool testBit(const std::vector<uint64_t>& bits, size_t index) {
+        return (bits[index >> 6] >> (index & 63)) & 1u;
+    }
+
+public:
+    FieldOfView();
+
+    // Recomputes the visible set if the player changed tile or the floor changed
+    void update(const MapGenerator& map, Vector2 viewerCenter);
+
+    bool isVisible(int tileX, int tileY) const;
+    bool isExplored(int tileX, int tileY) const;
+    bool isWorldPositionVisible(Vector2 worldPos) const;
+
+    // Darkens explored-but-unseen tiles and blacks out unexplored ones within `view` (world space)
+    void drawFog(Rectangle view) const;
+
+    unsigned int getExploredVersion() const { return exploredVersion; }
+    int getVisibleCount() const;
+
+    // Explored bitset as hex words, for the save file
+    std::string exportExplored() const;
+    bool importExplored(const MapGenerator& map, const std::string& data);
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include "MapGenerator.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Floors this session has already built, keyed by (run seed, floor number).
+// The most recent FLOOR_CACHE_SIZE snapshots stay in memory, most recently
+// used first. Older ones are appended to a spill file and read back when the
+// floor is needed again, so revisiting a floor or reloading the run never
+// reruns the generator or re-bakes wall rects, the distance field or the
+// static lightmap.
+//
+// The spill file is scratch space for this session: it is truncated when
+// first written and deleted with the cache. Each record is the snapshot and
+// its lightmap encoded with ByteWriter, checked against a CRC-32 kept in the
+// index.
+class FloorCache {
+private:
+    struct Entry {
+        uint32_t runSeed;
+        int floor;
+        FloorSnapshot snapshot;
+        std::vector<Color> lightmap;  // LightingSystem::bakeLightmap output, empty if never baked
+        int lightCount;
+    };
+
+    struct SpillRecord {
+        uint32_t runSeed;
+        int floor;
+        uint32_t floorSeed;
+        long offset;
+        uint32_t size;
+        uint32_t checksum;
+    };
+
+    std::vector<Entry> entries;  // Most recently used first
+    std::vector<SpillRecord> spilled;
+    std::string spillFilename;
+    std::FILE* spillFile;
+    long spillSize;
+    std::string buffer;  // Encode/decode scratch, reused by every spill
+
+    int hits;
+    int spillHits;
+    int misses;
+
+    void insert(Entry&& entry);
+    void spill(const Entry& entry);
+    bool readSpilled(const SpillRecord& record, Entry& out);
+    void closeSpillFile();
+
+public:
+    explicit FloorCache(const std::string& filename);
+    ~FloorCache();
+
+    FloorCache(const FloorCache&) = delete;
+    FloorCache& operator=(const FloorCache&) = delete;
+
+    // Loads the floor into `map` if it is cached with this floor seed and
+    // copies out its baked lightmap for LightingSystem::adoptLightmap.
+    // Counts a hit, a spill hit or a miss.
+    bool restore(MapGenerator& map, uint32_t runSeed, int floor, uint32_t floorSeed,
+                 std::vector<Color>& lightmap, int& lightCount);
+    // Caches the floor `map` currently holds, with its baked lightmap
+    void store(const MapGenerator& map, uint32_t runSeed, int floor, const std::vector<Color>& lightmap, int lightCount);
+    // Caches a floor that was exported elsewhere, e.g. by FloorPrefetcher
+    void store(uint32_t runSeed, int floor, FloorSnapshot&& snapshot, const std::vector<Color>& lightmap, int lightCount) {
+        insert(Entry{runSeed, floor, std::move(snapshot), lightmap, lightCount});
+    }
+
+    int getHits() const { return hits; }
+    int getSpillHits() const { return spillHits; }
+    int getMisses() const { return misses; }
+    int getCachedCount() const { return (int)entries.size(); }
+    int getSpilledCount() const { return (int)spilled.size(); }
+    long getSpillSize() const { return spillSize; }
+};
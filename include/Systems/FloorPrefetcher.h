@@ -0,0 +1,79 @@
+#pragma once
+#include "MapGenerator.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A floor built off the render thread, ready to be swapped in
+struct PreparedFloor {
+    uint32_t runSeed = 0;
+    int floor = 0;
+    FloorSnapshot snapshot;
+    std::vector<Color> lightmap;  // Baked on the worker; only the upload is left
+    int lightCount = 0;
+};
+
+// Builds the next floor on a background thread before the player reaches
+// it. The worker has its own MapGenerator, so generation, the wall and
+// distance field bakes and the lightmap bake never touch the live map.
+// At the transition the game takes the result and imports it, which costs
+// a copy and a texture upload instead of a full generation.
+//
+// Only the latest request matters: asking for another floor replaces a
+// request the worker hasn't started, and its result replaces an older one.
+class FloorPrefetcher {
+private:
+    struct Job {
+        uint32_t runSeed = 0;
+        int floor = 0;
+        uint32_t floorSeed = 0;
+
+        bool matches(uint32_t seed, int number, uint32_t numberSeed) const {
+            return runSeed == seed && floor == number && floorSeed == numberSeed;
+        }
+    };
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+
+    std::unique_ptr<MapGenerator> map;  // Only the worker touches this
+    Job pending;
+    bool hasPending;
+    bool working;
+    bool stopping;
+    PreparedFloor ready;
+    bool hasReady;
+
+    // Render thread only, so repeated requests for the same floor stay lock-free
+    Job requested;
+    bool hasRequested;
+
+    std::atomic<bool> busy;
+    std::atomic<int> preparedCount;
+    int usedCount;
+
+    void run();
+
+public:
+    FloorPrefetcher();
+    ~FloorPrefetcher();
+
+    FloorPrefetcher(const FloorPrefetcher&) = delete;
+    FloorPrefetcher& operator=(const FloorPrefetcher&) = delete;
+
+    // Starts preparing the floor; cheap to call every frame for the same floor
+    void request(uint32_t runSeed, int floor, uint32_t floorSeed);
+    // Hands over the requested floor, waiting for the worker if it is still
+    // building it. Returns false if this floor was never requested.
+    bool take(uint32_t runSeed, int floor, uint32_t floorSeed, PreparedFloor& out);
+
+    bool isWorking() const { return busy; }
+    int getPreparedCount() const { return preparedCount; }
+    int getUsedCount() const { return usedCount; }
+};
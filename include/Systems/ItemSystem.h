@@ -1,7 +1,6 @@
 #pragma once
 #include "raylib.h"
-#include <string>
-#include <vector>
+#include <string_view>
 
 enum class ItemType {
     // Consumables - Potions
@@ -42,13 +41,15 @@ enum class ItemType {
     // Quest Items
     ANCIENT_KEY,
     TREASURE_MAP,
-    MYSTICAL_RUNE
+    MYSTICAL_RUNE,
+
+    COUNT
 };
 
 struct Item {
     ItemType type;
-    std::string name;
-    std::string description;
+    std::string_view name;
+    std::string_view description;
     Color color;
     int rarity; // 1=common, 2=rare, 3=epic, 4=legendary
     int maxStack;
@@ -57,13 +58,10 @@ struct Item {
 };
 
 class ItemSystem {
-private:
-    static std::vector<Item> itemDatabase;
-
 public:
-    static void initialize();
-    static Item getItem(ItemType type);
-    static std::string getItemName(ItemType type);
+    static const Item& getItem(ItemType type);
+    static const Item* findItemByName(std::string_view name);
+    static std::string_view getItemName(ItemType type);
     static Color getItemColor(ItemType type);
     static bool isConsumable(ItemType type);
     static bool isEquipment(ItemType type);
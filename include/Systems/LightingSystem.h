@@ -0,0 +1,57 @@
+#pragma once
+#include "raylib.h"
+#include "Config.h"
+#include <array>
+#include <vector>
+
+class MapGenerator;
+
+// Static lights (torches, magic stones, runes) are baked once per floor, with
+// wall occlusion, into a low-resolution lightmap that is multiplied over the
+// map. Only dynamic lights (player, spells) are drawn per frame, as additive
+// glows, and there are at most Config::MAX_DYNAMIC_LIGHTS of them.
+class LightingSystem {
+private:
+    struct DynamicLight {
+        Vector2 position;
+        float radius;
+        Color color;
+    };
+
+    Texture2D lightmap;
+    std::vector<Color> lightmapPixels;
+    unsigned int bakedGeneration;
+    bool baked;
+    int bakedLightCount;
+
+    std::array<DynamicLight, Config::MAX_DYNAMIC_LIGHTS> dynamicLights;
+    int dynamicLightCount;
+
+    void bake(const MapGenerator& map);
+    void uploadLightmap(const MapGenerator& map, int lightCount);
+
+public:
+    LightingSystem();
+    ~LightingSystem();
+
+    LightingSystem(const LightingSystem&) = delete;
+    LightingSystem& operator=(const LightingSystem&) = delete;
+
+    // Dynamic lights are collected fresh every frame
+    void beginFrame();
+    void addDynamicLight(Vector2 position, float radius, Color color);
+
+    // CPU half of the bake: fills `pixels` with the lightmap of the map's
+    // static lights and returns how many were baked. Only reads the map, so
+    // it can run on a worker thread against a map no one else is using.
+    static int bakeLightmap(const MapGenerator& map, std::vector<Color>& pixels);
+    // Uploads a lightmap baked with bakeLightmap for the map's current floor
+    void adoptLightmap(const MapGenerator& map, std::vector<Color>&& pixels, int lightCount);
+
+    // Re-bakes if the floor changed, then draws the lightmap and dynamic lights
+    void draw(const MapGenerator& map);
+    void unload();
+
+    int getBakedLightCount() const { return bakedLightCount; }
+    int getDynamicLightCount() const { return dynamicLightCount; }
+};
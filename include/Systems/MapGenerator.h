@@ -2,9 +2,16 @@
 #include "raylib.h"
 #include <vector>
 #include <random>
+#include <cstdint>
+#include "Config.h"
 
 enum class TileType { FLOOR, WALL, DOOR, TRAP };
 
+enum class FloorStyle {
+    ROOMS,  // BSP rooms joined by corridors
+    CAVES   // Cellular-automaton caves, see CaveGenerator
+};
+
 struct Tile {
     TileType type;
     Vector2 position;
@@ -19,36 +26,130 @@ struct Room {
     int x, y, width, height;
 };
 
+// Maximal rectangle of wall tiles, in tile units
+struct WallRect {
+    int x, y, width, height;
+};
+
+// A generated floor in compact form, enough to restore it without running
+// the generator or re-baking its wall data. Tiles are one byte each and the
+// distance field is stored in 1/8 pixel steps, rounded down so restored
+// clearances stay conservative. See FloorCache.
+struct FloorSnapshot {
+    uint32_t floorSeed = 0;
+    uint32_t layoutChecksum = 0;
+    std::vector<uint8_t> tileTypes;  // TileType per tile, row-major
+    std::vector<Room> rooms;
+    std::vector<WallRect> wallRects;
+    std::vector<uint16_t> wallDistance;
+    std::vector<int> spawnTiles;
+    std::vector<Vector2> decorationPositions;
+    std::vector<int> decorationTypes;
+
+    size_t getByteSize() const;
+};
+
 class MapGenerator {
 private:
     int mapWidth;
     int mapHeight;
     int tileSize;
+    unsigned int generation;  // Bumped every time a new floor is generated
     std::vector<std::vector<Tile>> tiles;
     std::vector<Room> rooms;
+    std::vector<WallRect> wallRects;
+    int wallTileCount;
+    std::vector<uint64_t> wallBits;  // One bit per tile, row-major, for raycasts
+
+    // Euclidean distance (pixels) from each distance field cell centre to the
+    // nearest wall cell centre, DISTANCE_FIELD_SUBDIVISIONS cells per tile side
+    std::vector<float> wallDistance;
+    int fieldWidth;
+    int fieldHeight;
+    std::vector<int> spawnTiles;  // Floor tiles with enough wall clearance to spawn on
+    uint32_t floorSeed;
+    uint32_t layoutChecksum;  // Hash of the wall layer, see buildWallBits
     std::mt19937 rng;
     std::vector<Vector2> decorativeElements;
     std::vector<int> decorativeTypes; // 0=water, 1=magic stone, 2=torch, 3=rune
 
+    void generateRooms(int floorNumber);
+    void generateCaves();
     void carvePath(int x1, int y1, int x2, int y2);
     void carveRoom(int x, int y, int w, int h);
-    void connectRooms();
+    void buildWallRects();
+    void buildWallBits();
+    void buildDistanceField();
 
 public:
     MapGenerator(int width, int height, int tSize);
 
-    void generateFloor(int floorNumber);
+    void generateFloor(int floorNumber, uint32_t seed, FloorStyle style);
+    void generateFloor(int floorNumber, uint32_t seed) { generateFloor(floorNumber, seed, getFloorStyle(floorNumber)); }
+    // The style follows from the floor number alone, so a floor rebuilt from
+    // its seed (saves, the floor cache, prefetching) always matches
+    static FloorStyle getFloorStyle(int floorNumber);
+
+    // The steps generateFloor runs for a ROOMS floor, in order; separate so
+    // tools/mapgen_bench can time the BSP split and the corridor pass apart.
+    // Calling them directly skips the wall data bakes.
+    void beginFloor(uint32_t seed);
+    int rollRoomCount(int floorNumber);
+    std::vector<Room> splitRegions(int count);
+    void placeRooms(const std::vector<Room>& regions);
+    void connectRooms(const std::vector<Room>& regions);
+
+    // Snapshot round trip for the floor cache. importFloor rejects snapshots
+    // for another map size or whose walls don't match their checksum; the
+    // map is then left half-restored and must be regenerated.
+    void exportFloor(FloorSnapshot& out) const;
+    bool importFloor(const FloorSnapshot& snapshot);
+
     void draw();
     void drawDecorations();
 
     bool isWall(float x, float y) const;
+    TileType getTileType(int gridX, int gridY) const;
     Vector2 getRandomSpawnPosition();
+    Vector2 getRandomSpawnPosition(Vector2 avoid, float minDistance);
     std::vector<Vector2> getSpawnPositions(int count);
+    std::vector<Vector2> getSpawnPositions(int count, Vector2 avoid, float minDistance);
+
+    // Conservative distance in pixels from a point to the nearest wall (0 inside walls)
+    float getWallClearance(Vector2 worldPos) const;
+    bool circleHitsWall(Vector2 center, float radius) const { return getWallClearance(center) < radius; }
 
     Vector2 resolveCollision(Rectangle bounds, Vector2 movement);
 
+    // Swept tests against the merged wall rectangles. sweepBox returns how much
+    // of `movement` the box can travel before touching a wall; raycast returns
+    // the fraction of the segment travelled before the first wall (1 if none).
+    Vector2 sweepBox(Rectangle bounds, Vector2 movement) const;
+    float raycast(Vector2 from, Vector2 to) const;
+
+    // Grid DDA over the wall bitset. The tile containing `from` never blocks.
+    // Returns true and (optionally) the entry point if a wall is crossed.
+    bool raycastTiles(Vector2 from, Vector2 to, Vector2* hitPoint = nullptr) const;
+    bool hasLineOfSight(Vector2 from, Vector2 to) const { return !raycastTiles(from, to); }
+    bool isWallTile(int gridX, int gridY) const {
+        if (gridX < 0 || gridX >= mapWidth || gridY < 0 || gridY >= mapHeight) return true;
+        size_t index = (size_t)gridY * mapWidth + gridX;
+        return (wallBits[index >> 6] >> (index & 63)) & 1u;
+    }
+
     // Getters
     int getMapWidth() const { return mapWidth; }
     int getMapHeight() const { return mapHeight; }
     int getTileSize() const { return tileSize; }
+    unsigned int getGeneration() const { return generation; }
+    uint32_t getFloorSeed() const { return floorSeed; }
+    uint32_t getLayoutChecksum() const { return layoutChecksum; }
+    const std::vector<Vector2>& getDecorationPositions() const { return decorativeElements; }
+    const std::vector<int>& getDecorationTypes() const { return decorativeTypes; }
+    const std::vector<WallRect>& getWallRects() const { return wallRects; }
+    int getWallTileCount() const { return wallTileCount; }
+    const std::vector<float>& getWallDistanceField() const { return wallDistance; }
+    int getDistanceFieldWidth() const { return fieldWidth; }
+    int getDistanceFieldHeight() const { return fieldHeight; }
+    float getDistanceFieldCellSize() const { return (float)tileSize / Config::DISTANCE_FIELD_SUBDIVISIONS; }
 };
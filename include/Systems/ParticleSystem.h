@@ -1,32 +1,46 @@
 #pragma once
 #include "raylib.h"
+#include "Config.h"
 #include <vector>
+#include <cstdint>
 
-struct Particle {
-    Vector2 position;
-    Vector2 velocity;
-    Color color;
-    float life;
-    float maxLife;
-    float size;
-
-    Particle(Vector2 pos, Vector2 vel, Color col, float lifetime, float sz)
-        : position(pos), velocity(vel), color(col), life(lifetime), maxLife(lifetime), size(sz) {}
-};
-
+// Fixed-capacity particle pool stored as structure-of-arrays.
+// Live particles are packed in [0, count); dead ones are swap-removed.
 class ParticleSystem {
 private:
-    std::vector<Particle> particles;
+    int capacity;
+    int count;
+
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> life;
+    std::vector<float> invMaxLife;
+    std::vector<float> alpha;
+    std::vector<float> size;
+    std::vector<Color> colors;
+
+    uint32_t rngState;
+
+    uint32_t nextRandom();
+    float randomFloat(float min, float max);
+    int emit(Vector2 position, Color color, int amount, float minSpeed, float maxSpeed,
+             float minLife, float maxLife, float minSize, float maxSize);
+    void kill(int index);
 
 public:
-    void addExplosion(Vector2 position, Color color, int count = 15);
-    void addBlood(Vector2 position, int count = 8);
-    void addMagic(Vector2 position, Color color, int count = 10);
-    void addHeal(Vector2 position, int count = 5);
+    explicit ParticleSystem(int maxParticles = Config::MAX_PARTICLES);
+
+    void addExplosion(Vector2 position, Color color, int amount = 15);
+    void addBlood(Vector2 position, int amount = 8);
+    void addMagic(Vector2 position, Color color, int amount = 10);
+    void addHeal(Vector2 position, int amount = 5);
 
     void update(float deltaTime);
     void draw();
     void clear();
 
-    int getParticleCount() const { return particles.size(); }
+    int getParticleCount() const { return count; }
+    int getCapacity() const { return capacity; }
 };
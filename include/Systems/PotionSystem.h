@@ -1,31 +1,29 @@
 #pragma once
-#include <string>
-#include <vector>
+#include <string_view>
 
 enum class PotionType {
     HEALTH,
     SPEED,
     STEALTH,
     RAGE,
-    MANA
+    MANA,
+    HOLY_WATER,
+
+    COUNT
 };
 
 struct PotionEffect {
     PotionType type;
-    std::string name;
-    std::string description;
+    std::string_view name;
+    std::string_view description;
     int effectValue;
     float effectDuration;
     int rarity; // 1 = common, 2 = rare, 3 = epic
 };
 
 class PotionSystem {
-private:
-    static std::vector<PotionEffect> potions;
-
 public:
-    static void initialize();
-    static PotionEffect getPotionEffect(PotionType type);
-    static PotionEffect getPotionByName(const std::string& name);
-    static std::string getPotionDescription(PotionType type);
+    static const PotionEffect& getPotionEffect(PotionType type);
+    static const PotionEffect& getPotionByName(std::string_view name);
+    static std::string_view getPotionDescription(PotionType type);
 };
@@ -0,0 +1,73 @@
+#pragma once
+#include "raylib.h"
+#include "Config.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+class MapGenerator;
+class Enemy;
+
+enum class ProjectileOwner : uint8_t {
+    PLAYER,  // Hits enemies
+    ENEMY    // Hits the player
+};
+
+// A projectile that struck something this frame. enemyIndex indexes the
+// enemy list passed to update(), or is -1 when the player was hit.
+struct ProjectileHit {
+    Vector2 position;
+    int enemyIndex;
+    int damage;
+    Color color;
+};
+
+// Fixed-capacity projectile pool stored as structure-of-arrays, same layout
+// as ParticleSystem. Each step is swept against the wall bitset with a tile
+// DDA, and enemy hits go through a uniform grid rebuilt every update, so the
+// cost stays linear in the number of live projectiles.
+class ProjectileSystem {
+private:
+    int capacity;
+    int count;
+
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> life;
+    std::vector<float> radius;
+    std::vector<int> damage;
+    std::vector<ProjectileOwner> owner;
+    std::vector<Color> colors;
+
+    // Enemy broadphase: indices bucketed by grid cell (counting sort)
+    int gridWidth;
+    int gridHeight;
+    std::vector<int> cellStart;   // gridWidth * gridHeight + 1 offsets into cellItems
+    std::vector<int> cellItems;
+    std::vector<int> enemyCells;  // Scratch: first/last cell of each enemy's grown bounds
+
+    std::vector<ProjectileHit> hits;
+
+    void kill(int index);
+    void buildGrid(const MapGenerator& map, const std::vector<std::unique_ptr<Enemy>>& enemies);
+    int findEnemyHit(int index, const std::vector<std::unique_ptr<Enemy>>& enemies) const;
+
+public:
+    explicit ProjectileSystem(int maxProjectiles = Config::MAX_PROJECTILES);
+
+    // Returns false when the pool is full and the shot was dropped
+    bool fire(Vector2 origin, Vector2 target, float speed, int damage, float radius,
+              Color color, ProjectileOwner owner, float lifetime = Config::PROJECTILE_LIFETIME);
+
+    void update(float deltaTime, const MapGenerator& map,
+                const std::vector<std::unique_ptr<Enemy>>& enemies, Rectangle playerBounds);
+    void draw(Rectangle view) const;
+    void clear();
+
+    // Hits from the last update, for the game to apply damage and feedback
+    const std::vector<ProjectileHit>& getHits() const { return hits; }
+    int getProjectileCount() const { return count; }
+    int getCapacity() const { return capacity; }
+};
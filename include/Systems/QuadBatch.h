@@ -0,0 +1,35 @@
+#pragma once
+#include "raylib.h"
+
+// Writes particles and effect primitives as textured quads straight into the
+// active rlgl vertex batch. Everything samples one soft-circle texture, so a
+// whole particle system or effect pass is a single draw call.
+class QuadBatch {
+private:
+    static Texture2D softCircle;
+    static bool ready;
+    static bool drawing;
+
+    static int frameVertices;
+    static int frameBatches;
+
+    static void pushQuad(Vector2 a, Vector2 b, Vector2 c, Vector2 d,
+                         float u0, float v0, float u1, float v1, Color color);
+
+public:
+    static void initialize();
+    static void shutdown();
+    static bool isReady() { return ready; }
+
+    // Stats cover everything drawn since the last beginFrame()
+    static void beginFrame();
+    static int getFrameVertices() { return frameVertices; }
+    static int getFrameBatches() { return frameBatches; }
+
+    static void begin();
+    static void end();
+
+    static void addCircle(Vector2 center, float radius, Color color);
+    static void addLine(Vector2 from, Vector2 to, float thickness, Color color);
+    static void addRing(Vector2 center, float radius, float thickness, Color color);
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include "Enemy.h"
+#include <string>
+#include <vector>
+#include <random>
+
+// Cumulative spawn weights for one player-level band
+struct SpawnBand {
+    int minLevel;
+    std::vector<EnemyType> types;
+    std::vector<float> cumulative;
+};
+
+// Per-floor weight multiplier read from the spawn weights file
+struct SpawnWeightOverride {
+    int firstFloor;
+    int lastFloor;
+    EnemyType type;
+    float multiplier;
+};
+
+class SpawnTable {
+private:
+    std::vector<SpawnWeightOverride> overrides;
+    std::vector<SpawnBand> bands;
+    int builtFloor;
+
+    float getFloorMultiplier(EnemyType type, int floorNumber) const;
+
+public:
+    SpawnTable();
+
+    bool loadFloorWeights(const std::string& filename);
+    void buildForFloor(int floorNumber);
+    EnemyType sample(int playerLevel, std::mt19937& rng) const;
+
+    int getBuiltFloor() const { return builtFloor; }
+};
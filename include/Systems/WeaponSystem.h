@@ -1,23 +1,30 @@
 #pragma once
-#include <string>
-#include <vector>
+#include <string_view>
+
+enum class WeaponType {
+    WOODEN_SWORD,
+    IRON_KATANA,
+    STEEL_DAGGER,
+    SHURIKEN,
+    SHADOW_BALL,
+
+    COUNT
+};
 
 struct WeaponStats {
-    std::string name;
+    WeaponType type;
+    std::string_view name;
     int baseDamage;
     float speedMultiplier;  // Attack speed
     float critChance;
-    std::string description;
+    std::string_view description;
     int requiredLevel;
 };
 
 class WeaponSystem {
-private:
-    static std::vector<WeaponStats> weapons;
-
 public:
-    static void initialize();
-    static WeaponStats getWeaponStats(const std::string& weaponName);
-    static std::string getWeaponDescription(const std::string& weaponName);
-    static int getWeaponDamage(const std::string& weaponName, int basePlayerDamage);
+    static const WeaponStats& getWeaponStats(WeaponType type);
+    static const WeaponStats& getWeaponStats(std::string_view weaponName);
+    static std::string_view getWeaponDescription(std::string_view weaponName);
+    static int getWeaponDamage(std::string_view weaponName, int basePlayerDamage);
 };
@@ -1,5 +1,7 @@
 #pragma once
 #include "raylib.h"
+#include "MiniMap.h"
+#include <array>
 #include <string>
 #include <vector>
 
@@ -9,6 +11,10 @@ class Player;
 class HUD {
 public:
     HUD(int width, int height);
+    ~HUD();
+
+    HUD(const HUD&) = delete;
+    HUD& operator=(const HUD&) = delete;
 
     void draw(Game* game, Player* player);
 
@@ -17,18 +23,45 @@ public:
     void setSelectedInventoryItem(int idx) { selectedInventoryItem = idx; }
 
 private:
+    // Retained panel: contents are rendered once into a texture and blitted
+    // every frame until one of the inputs recorded in `key` changes.
+    using PanelKey = std::array<int, 8>;
+
+    struct CachedPanel {
+        RenderTexture2D target = {};
+        PanelKey key = {};
+        bool dirty = true;
+    };
+
     int screenWidth;
     int screenHeight;
 
     Rectangle statsPanel;
     Rectangle inventoryPanel;
+    Rectangle controlsPanel;
+    Rectangle buffPanel;
+
+    CachedPanel statsCache;
+    CachedPanel inventoryCache;
+    CachedPanel controlsCache;
+    CachedPanel buffCache;
+
+    MiniMap miniMap;
 
     int selectedInventoryItem;
 
-    // Panel drawing
+    // Panel caching
+    void updateLayout();
+    void markAllDirty();
+    bool needsRebuild(CachedPanel& panel, const Rectangle& bounds, const PanelKey& key);
+    void blitPanel(const CachedPanel& panel, const Rectangle& bounds, Color background);
+    void unloadPanel(CachedPanel& panel);
+
+    // Panel drawing (in panel-local coordinates, into the panel's texture)
     void drawStatsPanel(Game* game, Player* player);
     void drawInventoryPanel(Player* player);
     void drawControlsPanel();
     void drawBuffIndicators(Player* player);
     void drawMiniMap(Game* game);
+    void drawSaveIndicator(Game* game);
 };
@@ -1,6 +1,8 @@
 #pragma once
 #include "raylib.h"
+#include "SaveSystem.h"
 #include <string>
+#include <vector>
 
 enum class MenuState {
     MAIN_MENU,
@@ -18,6 +20,12 @@ private:
     int selectedOption;
     bool saveExists;
 
+    // Save slots, read from the slot index only
+    std::vector<SaveSummary> saves;
+    int selectedSave;   // Row in the load list
+    int selectedSlot;   // Slot the game should use
+    int overwriteRow;   // Row of the save a new game replaces when every slot is taken, else -1
+
     // Settings
     float masterVolume;
     float musicVolume;
@@ -43,8 +51,12 @@ public:
     bool getEnableParticles() const { return enableParticles; }
     bool doesSaveExist() const { return saveExists; }
     std::string getPlayerName() const { return playerName; }
+    int getSelectedSlot() const { return selectedSlot; }
 
 private:
+    void refreshSaves();
+    void beginNewGame();
+
     void drawMainMenu();
     void drawNewGame();
     void drawLoadGame();
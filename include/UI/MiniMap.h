@@ -0,0 +1,43 @@
+#pragma once
+#include "raylib.h"
+#include <vector>
+#include <cstdint>
+
+class Game;
+class MapGenerator;
+class FieldOfView;
+
+// Minimap drawn from cached layers: the tile layer is rendered into a
+// RenderTexture once per floor, unexplored tiles are covered by a one-texel-
+// per-tile mask that is re-uploaded only when the field of view explores new
+// tiles, and the moving markers (player, companion, visible enemies) go out
+// as one quad batch.
+class MiniMap {
+private:
+    int width;
+    int height;
+
+    RenderTexture2D tileLayer;
+    Texture2D exploredMask;
+    std::vector<Color> maskPixels;
+    unsigned int maskExploredVersion;
+
+    unsigned int builtGeneration;
+    bool built;
+
+    void rebuild(const MapGenerator& map);
+    void updateMask(const FieldOfView& fov, int mapWidth, int mapHeight);
+    void unload();
+
+public:
+    MiniMap(int width, int height);
+    ~MiniMap();
+
+    MiniMap(const MiniMap&) = delete;
+    MiniMap& operator=(const MiniMap&) = delete;
+
+    void draw(Game* game, int x, int y);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include "raylib.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// Pre-rendered text for things drawn every frame (damage digits, enemy names).
+// Each distinct label is rendered once into a shared RenderTexture and then
+// drawn as a single textured quad, so per-frame drawing needs no strings.
+class TextAtlas {
+private:
+    struct Label {
+        Rectangle source; // In atlas texture space, already Y-flipped
+        int width;
+        int height;
+    };
+
+    static RenderTexture2D atlas;
+    static bool ready;
+    static std::vector<Label> labels;
+    static std::unordered_map<std::string, int> labelIds;
+    static int cursorX;
+    static int cursorY;
+    static int rowHeight;
+
+    static int digitIds[10];
+    static int minusId;
+
+public:
+    static constexpr int ATLAS_SIZE = 512;
+    static constexpr int DIGIT_FONT_SIZE = 16;
+
+    static void initialize();
+    static void shutdown();
+    static bool isReady() { return ready; }
+
+    // Returns -1 when the atlas isn't ready or is full; callers fall back to DrawText
+    static int registerLabel(const std::string& text, int fontSize);
+    static void drawLabel(int labelId, Vector2 position, Color tint);
+
+    // Draws "-<value>" from the digit glyphs without building a string
+    static void drawNegativeNumber(int value, Vector2 position, Color tint);
+};
@@ -4,6 +4,8 @@
 #include "PotionSystem.h"
 #include "ItemSystem.h"
 #include "MainMenu.h"
+#include "TextAtlas.h"
+#include "QuadBatch.h"
 #include "raymath.h"
 #include <iostream>
 #include <algorithm>
@@ -11,11 +13,15 @@
 #include <cstdio>
 
 Game::Game() : isRunning(true), isPaused(false), gameOver(false), gameTime(0),
-               currentFloor(1), score(0), enemiesKilled(0),
+               currentFloor(1), runSeed(0), floorCache(Config::FLOOR_CACHE_SPILL_FILE), score(0), enemiesKilled(0),
                rng(std::random_device{}()), enemySpawnTimer(0), maxEnemies(3),
-               cameraShakeTime(0), cameraShakeIntensity(0), attackFlashTimer(0),
+               cameraShakeTime(0), cameraShakeIntensity(0), damageNumberHead(0), damageNumberCount(0),
+               attackFlashTimer(0), showDebugOverlay(false), showDistanceField(false),
+               saveSlot(0), autosaveTimer(0), autosavePending(false), journaledLevel(1), journaledInventoryVersion(0),
                inventoryOpen(false) {
 
+    setSaveSlot(0);
+
     // ONLY initialize window, NOT the game!
     InitWindow(Config::SCREEN_WIDTH, Config::SCREEN_HEIGHT, Config::GAME_TITLE);
     SetTargetFPS(Config::TARGET_FPS);
@@ -35,6 +41,8 @@ void Game::initialize() {
     SetConfigFlags(FLAG_WINDOW_RESIZABLE | FLAG_WINDOW_MAXIMIZED);
     InitWindow(Config::SCREEN_WIDTH, Config::SCREEN_HEIGHT, Config::GAME_TITLE);
     SetTargetFPS(Config::TARGET_FPS);
+    TextAtlas::initialize();
+    QuadBatch::initialize();
 
     int screenWidth = GetScreenWidth();
     int screenHeight = GetScreenHeight();
@@ -46,16 +54,24 @@ void Game::initialize() {
 
     // Initialize audio and systems
     soundManager.initialize();
-    WeaponSystem::initialize();
-    PotionSystem::initialize();
-    ItemSystem::initialize();
+
+    // Read the save before generating so the floor is built from its seed
+    // once, instead of generating a random floor and then replacing it
+    bool loaded = hasSaveFile() && readSaveData();
+    if (loaded) currentFloor = saveData.currentFloor;
+    runSeed = loaded && saveData.hasRunState ? saveData.runSeed : std::random_device{}();
 
     // Generate first floor
-    gameMap->generateFloor(currentFloor);
+    buildFloor(currentFloor, loaded && saveData.hasRunState ? saveData.floorSeed : floorSeedFor(currentFloor));
+    decals.clear();
+    projectiles.clear();
+    spawnTable.loadFloorWeights(Config::SPAWN_WEIGHTS_FILE);
+    spawnTable.buildForFloor(currentFloor);
 
     // Set player starting position
     Vector2 startPos = gameMap->getRandomSpawnPosition();
     player->setPosition(startPos);
+    updateFieldOfView();
 
     // Initialize camera
     camera.target = player->getPosition();
@@ -66,11 +82,17 @@ void Game::initialize() {
     // Spawn initial enemies
     spawnEnemies();
 
-    // Load save if exists
-    if (SaveSystem::saveExists(Config::SAVE_FILE)) {
-        loadGame();
+    // Restore the saved run on top of the fresh floor
+    if (loaded) {
+        applySaveData();
     }
 
+    // The journal restarts with the first snapshot of this session, taken
+    // at the end of the first frame once a new game has its name set
+    journal.close();
+    autosaveTimer = 0;
+    requestAutosave();
+
     std::cout << "Game initialized successfully!" << std::endl;
 }
 
@@ -94,8 +116,11 @@ void Game::run() {
                         // NEW GAME - Delete old save and start fresh
                         std::cout << "Starting NEW GAME..." << std::endl;
 
-                        // DELETE the old save file
-                        std::remove(Config::SAVE_FILE);
+                        // The menu picked a free slot, or the oldest one when all are
+                        // taken and the player confirmed replacing it; clear it
+                        setSaveSlot(mainMenu->getSelectedSlot());
+                        journal.close();
+                        SaveSystem::deleteSave(saveSlot);
 
                         // Initialize fresh game
                         initialize();
@@ -113,11 +138,12 @@ void Game::run() {
                     else if (selectedMenu == MenuState::LOAD_GAME) {
                         // RESUME GAME - Load existing save
                         std::cout << "Resuming saved game..." << std::endl;
+                        setSaveSlot(mainMenu->getSelectedSlot());
 
+                        // initialize() restores the save when there is one
                         initialize();
 
-                        if (SaveSystem::saveExists(Config::SAVE_FILE)) {
-                            loadGame();
+                        if (hasSaveFile()) {
                             std::cout << "Loaded game for: " << player->playerName << std::endl;
                         } else {
                             std::cout << "No save file found, starting fresh..." << std::endl;
@@ -153,7 +179,9 @@ void Game::update(float deltaTime) {
     }
 
     updatePlayer(deltaTime);
+    updateFieldOfView();
     updateEnemies(deltaTime);
+    updateProjectiles(deltaTime);
     updateParticles(deltaTime);
     updateCamera();
     updateDamageNumbers(deltaTime);
@@ -162,6 +190,12 @@ void Game::update(float deltaTime) {
     checkCollisions();
     removeDeadEnemies();
 
+    // The floor change is predictable, so the next floor is built on the
+    // prefetch worker while the player closes in on it
+    if (player->getLevel() > currentFloor * Config::LEVELS_PER_FLOOR - Config::FLOOR_PREFETCH_LEVELS) {
+        floorPrefetcher.request(runSeed, currentFloor + 1, floorSeedFor(currentFloor + 1));
+    }
+
     if (player->getLevel() > currentFloor * Config::LEVELS_PER_FLOOR) {
         generateNewFloor();
     }
@@ -176,6 +210,8 @@ void Game::update(float deltaTime) {
     if (!player->getIsAlive()) {
         gameOver = true;
     }
+
+    updateAutosave(deltaTime);
 }
 
 void Game::handleInput() {
@@ -191,8 +227,16 @@ void Game::handleInput() {
             const auto& inventory = player->getInventory();
             if (!inventory.empty() && hud->getSelectedInventoryItem() < (int)inventory.size()) {
                 const auto& selectedItem = inventory[hud->getSelectedInventoryItem()];
-                player->useItem(selectedItem.name);
-                effectSystem.addSpellCastReady(player->getPosition());
+                const Item* data = ItemSystem::findItemByName(selectedItem.name);
+
+                if (data && ItemSystem::isThrowable(data->type)) {
+                    // Throwing needs the game running, so close the inventory first
+                    inventoryOpen = false;
+                    throwItem(selectedItem.name);
+                } else {
+                    player->useItem(selectedItem.name);
+                    effectSystem.addSpellCastReady(player->getPosition());
+                }
             }
         }
 
@@ -217,6 +261,14 @@ void Game::handleInput() {
         ToggleFullscreen();
     }
 
+    if (IsKeyPressed(KEY_F3)) {
+        showDebugOverlay = !showDebugOverlay;
+    }
+
+    if (IsKeyPressed(KEY_F4)) {
+        showDistanceField = !showDistanceField;
+    }
+
     if (IsKeyPressed(KEY_S) && IsKeyDown(KEY_LEFT_CONTROL)) {
         saveGame();
     }
@@ -234,6 +286,17 @@ void Game::handleInput() {
         if (IsKeyPressed(KEY_K)) player->useItem("Stealth Potion");
         if (IsKeyPressed(KEY_L)) player->useItem("Rage Potion");
 
+        // Throw the first throwable in the inventory
+        if (IsKeyPressed(KEY_T)) {
+            for (const auto& item : player->getInventory()) {
+                const Item* data = ItemSystem::findItemByName(item.name);
+                if (data && ItemSystem::isThrowable(data->type)) {
+                    throwItem(item.name);
+                    break;
+                }
+            }
+        }
+
         handleSpells();
     }
 }
@@ -265,11 +328,41 @@ void Game::updatePlayer(float deltaTime) {
     player->setPosition({oldPos.x + resolvedMovement.x, oldPos.y + resolvedMovement.y});
 }
 
+void Game::updateFieldOfView() {
+    // Cheap unless the player moved to another tile or the floor changed
+    Vector2 playerPos = player->getPosition();
+    fieldOfView.update(*gameMap, Vector2{playerPos.x + 16, playerPos.y + 16});
+}
+
+void Game::knockBackEnemy(Enemy& enemy, Vector2 from, float force) {
+    // Knockback teleports the enemy, so keep it out of the walls. A push no
+    // longer than the free space around the enemy's bounding circle is always
+    // safe; only pushes beyond that need the exact sweep.
+    Rectangle bounds = enemy.getBounds();
+    Vector2 oldPos = enemy.getPosition();
+    enemy.applyKnockback(from, force);
+
+    Vector2 push = {enemy.getPosition().x - oldPos.x, enemy.getPosition().y - oldPos.y};
+    Vector2 center = {bounds.x + bounds.width / 2, bounds.y + bounds.height / 2};
+    float boundingRadius = 0.5f * std::sqrt(bounds.width * bounds.width + bounds.height * bounds.height);
+    float freeDistance = gameMap->getWallClearance(center) - boundingRadius;
+
+    if (freeDistance < 0 || push.x * push.x + push.y * push.y > freeDistance * freeDistance) {
+        Vector2 allowed = gameMap->sweepBox(bounds, push);
+        enemy.setPosition({oldPos.x + allowed.x, oldPos.y + allowed.y});
+    }
+}
+
 void Game::updateEnemies(float deltaTime) {
     for (auto& enemy : enemies) {
         if (!enemy->getIsAlive()) continue;
 
         enemy->setTarget(player.get());
+        enemy->setMap(gameMap.get());
+        enemy->setProjectiles(&projectiles);
+
+        Vector2 enemyPos = enemy->getPosition();
+        enemy->setInPlayerView(fieldOfView.isWorldPositionVisible(Vector2{enemyPos.x + 16, enemyPos.y + 16}));
 
         Vector2 oldPos = enemy->getPosition();
         enemy->update(deltaTime);
@@ -284,6 +377,72 @@ void Game::updateEnemies(float deltaTime) {
     }
 }
 
+void Game::updateProjectiles(float deltaTime) {
+    Rectangle playerBounds = player->getIsAlive() ? player->getBounds() : Rectangle{-1000, -1000, 0, 0};
+    projectiles.update(deltaTime, *gameMap, enemies, playerBounds);
+
+    for (const ProjectileHit& hit : projectiles.getHits()) {
+        if (hit.enemyIndex < 0) {
+            player->takeDamage(hit.damage);
+            particleSystem.addMagic(hit.position, hit.color, 6);
+            addDamageNumber(Vector2{player->getPosition().x, player->getPosition().y - 10}, hit.damage, RED);
+            soundManager.playSound(SoundType::PLAYER_HIT);
+            continue;
+        }
+
+        // Several projectiles can land on the same enemy in one frame
+        Enemy& enemy = *enemies[hit.enemyIndex];
+        if (!enemy.getIsAlive()) continue;
+
+        enemy.takeDamage(hit.damage);
+        particleSystem.addBlood(enemy.getPosition(), 3);
+        addDamageNumber(Vector2{enemy.getPosition().x, enemy.getPosition().y - 10}, hit.damage, hit.color);
+
+        if (enemy.getIsAlive()) {
+            enemy.flashHit();
+        } else {
+            onEnemyKilled(enemy);
+        }
+    }
+}
+
+bool Game::throwItem(std::string_view itemName) {
+    const Item* item = ItemSystem::findItemByName(itemName);
+    if (!item || !ItemSystem::isThrowable(item->type) || !player->hasItem(itemName)) return false;
+
+    // Aim at the nearest enemy the player can see, otherwise at the cursor
+    Vector2 from = {player->getPosition().x + 16, player->getPosition().y + 16};
+    Vector2 aim = GetScreenToWorld2D(GetMousePosition(), camera);
+    float nearest = Config::THROW_AUTO_AIM_RANGE * Config::THROW_AUTO_AIM_RANGE;
+
+    for (const auto& enemy : enemies) {
+        if (!enemy->getIsAlive() || !enemy->isInPlayerView()) continue;
+
+        Vector2 center = {enemy->getPosition().x + 16, enemy->getPosition().y + 16};
+        float distSq = Vector2DistanceSqr(from, center);
+        if (distSq < nearest) {
+            nearest = distSq;
+            aim = center;
+        }
+    }
+
+    float speed = 520.0f;
+    float radius = 4.0f;
+    switch (item->type) {
+        case ItemType::THROWING_KNIFE: speed = 600.0f; radius = 3.0f; break;
+        case ItemType::MAGIC_ORB: speed = 380.0f; radius = 7.0f; break;
+        default: break;
+    }
+
+    if (!projectiles.fire(from, aim, speed, (int)item->effectValue, radius, item->color, ProjectileOwner::PLAYER)) {
+        return false;
+    }
+
+    player->useItem(itemName);
+    soundManager.playSound(SoundType::ATTACK_MAGIC);
+    return true;
+}
+
 void Game::updateCamera() {
     Vector2 targetPos = player->getPosition();
     camera.target.x += (targetPos.x - camera.target.x) * 0.1f;
@@ -307,22 +466,41 @@ void Game::updateCamera() {
     camera.target.y = std::clamp(camera.target.y, screenHeight / 2.0f, mapHeight - screenHeight / 2.0f);
 }
 
+void Game::addDamageNumber(Vector2 position, int damage, Color color) {
+    // When full, the oldest number is the one closest to expiring - overwrite it
+    if (damageNumberCount == Config::MAX_DAMAGE_NUMBERS) {
+        damageNumberHead = (damageNumberHead + 1) % Config::MAX_DAMAGE_NUMBERS;
+        damageNumberCount--;
+    }
+
+    int tail = (damageNumberHead + damageNumberCount) % Config::MAX_DAMAGE_NUMBERS;
+    damageNumbers[tail] = DamageNumber(position, damage, color);
+    damageNumberCount++;
+}
+
+void Game::clearDamageNumbers() {
+    damageNumberHead = 0;
+    damageNumberCount = 0;
+}
+
 void Game::updateDamageNumbers(float deltaTime) {
-    for (auto it = damageNumbers.begin(); it != damageNumbers.end();) {
-        it->timeLeft -= deltaTime;
-        it->position.y -= 30.0f * deltaTime;
-        it->color.a = (unsigned char)(255 * std::max(0.0f, it->timeLeft));
+    for (int i = 0; i < damageNumberCount; i++) {
+        DamageNumber& number = damageNumbers[(damageNumberHead + i) % Config::MAX_DAMAGE_NUMBERS];
+        number.timeLeft -= deltaTime;
+        number.position.y -= 30.0f * deltaTime;
+        number.color.a = (unsigned char)(255 * std::max(0.0f, number.timeLeft));
+    }
 
-        if (it->timeLeft <= 0) {
-            it = damageNumbers.erase(it);
-        } else {
-            ++it;
-        }
+    // Expired numbers are always at the head
+    while (damageNumberCount > 0 && damageNumbers[damageNumberHead].timeLeft <= 0) {
+        damageNumberHead = (damageNumberHead + 1) % Config::MAX_DAMAGE_NUMBERS;
+        damageNumberCount--;
     }
 }
 
 void Game::updateParticles(float deltaTime) {
     particleSystem.update(deltaTime);
+    effectSystem.update(deltaTime);
 }
 
 void Game::checkPlayerAttack() {
@@ -349,107 +527,16 @@ void Game::checkPlayerAttack() {
                 if (enemy->getIsAlive()) {
                     enemy->flashHit();
                     Vector2 center = {attackRange.x + attackRange.width / 2, attackRange.y + attackRange.height / 2};
-                    enemy->applyKnockback(center, 20.0f);
+                    knockBackEnemy(*enemy, center, 20.0f);
                 }
 
                 particleSystem.addBlood(enemy->getPosition(), 5);
-                damageNumbers.emplace_back(Vector2{enemy->getPosition().x, enemy->getPosition().y - 10},
-                                          finalDamage, crit ? ORANGE : RED);
+                decals.stamp(DecalType::BLOOD, Vector2{enemy->getPosition().x + 16, enemy->getPosition().y + 24}, 8.0f);
+                addDamageNumber(Vector2{enemy->getPosition().x, enemy->getPosition().y - 10},
+                                finalDamage, crit ? ORANGE : RED);
 
                 if (!enemy->getIsAlive()) {
-                    particleSystem.addExplosion(enemy->getPosition(), ORANGE, 10);
-                    int expReward = enemy->getLevel() * 25;
-                    player->gainExperience(expReward);
-                    score += enemy->getLevel() * 100;
-                    enemiesKilled++;
-
-                    damageNumbers.emplace_back(Vector2{enemy->getPosition().x + 15, enemy->getPosition().y - 15},
-                                              expReward, YELLOW);
-                    generateItemDrops(enemy.get());
-                    // TAMING SYSTEM - Chance to tame Shadow Paladin at level 35+
-                    if (enemy->getEnemyType() == EnemyType::FALLEN_SHADOW_PALADIN &&
-                        player->getLevel() >= 35 && !companionSystem.hasActiveCompanion()) {
-
-                        std::uniform_int_distribution<int> tamingChance(1, 100);
-                        if (tamingChance(rng) <= 30) { // 30% tame chance
-                            companionSystem.tameCompanion(CompanionType::FALLEN_SHADOW_PALADIN, player->getLevel());
-                            particleSystem.addMagic(enemy->getPosition(), Color{100, 255, 200, 255}, 20);
-
-                            // Show taming message
-                            DrawText("TAMED! Shadow Paladin joins you!",
-                                    GetScreenWidth() / 2 - 100, 100, 20, Color{0, 255, 136, 255});
-                        }
-                        }
-                    // Item drops
-                    std::uniform_int_distribution<int> dropChance(1, 100);
-                    int chance = dropChance(rng);
-
-                    if (chance <= 5) {
-                        // 5% - Legendary item
-                        std::vector<ItemType> legendaryItems = {
-                            ItemType::CLOAK_OF_INVISIBILITY,
-                            ItemType::MYSTICAL_RUNE,
-                            ItemType::ANCIENT_KEY
-                        };
-                        std::uniform_int_distribution<int> legendaryDist(0, legendaryItems.size() - 1);
-                        ItemType item = legendaryItems[legendaryDist(rng)];
-                        player->addItem(ItemSystem::getItemName(item), 1);
-                        particleSystem.addMagic(enemy->getPosition(), Color{255, 215, 0, 255}, 12);
-                    }
-                    else if (chance <= 15) {
-                        // 10% - Epic magical item
-                        std::vector<ItemType> epicItems = {
-                            ItemType::RING_OF_FIRE,
-                            ItemType::AMULET_OF_ICE,
-                            ItemType::BOOTS_OF_SWIFTNESS,
-                            ItemType::MAGIC_ORB,
-                            ItemType::SHIELD_PENDANT
-                        };
-                        std::uniform_int_distribution<int> epicDist(0, epicItems.size() - 1);
-                        ItemType item = epicItems[epicDist(rng)];
-                        player->addItem(ItemSystem::getItemName(item), 1);
-                        particleSystem.addMagic(enemy->getPosition(), Color{200, 0, 200, 255}, 10);
-                    }
-                    else if (chance <= 25) {
-                        // 10% - Weapon drop
-                        std::vector<ItemType> weapons = {
-                            // ItemType::IRON_KATANA,
-                            // ItemType::STEEL_DAGGER,
-                            ItemType::THROWING_KNIFE,
-                            ItemType::SHURIKEN
-                        };
-                        std::uniform_int_distribution<int> weaponDist(0, weapons.size() - 1);
-                        ItemType weapon = weapons[weaponDist(rng)];
-                        player->addItem(ItemSystem::getItemName(weapon), 1);
-                        particleSystem.addMagic(enemy->getPosition(), Color{192, 192, 192, 255}, 8);
-                    }
-                    else if (chance <= 50) {
-                        // 25% - Food items
-                        std::vector<ItemType> foodItems = {
-                            ItemType::MEAT,
-                            ItemType::APPLE,
-                            ItemType::BREAD,
-                            ItemType::CHEESE
-                        };
-                        std::uniform_int_distribution<int> foodDist(0, foodItems.size() - 1);
-                        ItemType food = foodItems[foodDist(rng)];
-                        int quantity = foodDist(rng) % 3 + 1; // 1-3 quantity
-                        player->addItem(ItemSystem::getItemName(food), quantity);
-                        particleSystem.addHeal(enemy->getPosition(), 5);
-                    }
-                    else if (chance <= 70) {
-                        // 20% - Potion drops
-                        std::vector<ItemType> potions = {
-                            ItemType::HEALTH_POTION,
-                            ItemType::SPEED_POTION,
-                            ItemType::STEALTH_POTION,
-                            ItemType::RAGE_POTION,
-                            ItemType::MANA_POTION
-                        };
-                        std::uniform_int_distribution<int> potionDist(0, potions.size() - 1);
-                        ItemType potion = potions[potionDist(rng)];
-                        player->addItem(ItemSystem::getItemName(potion), 1);
-                    }
+                    onEnemyKilled(*enemy);
                 }
             }
         }
@@ -464,6 +551,108 @@ void Game::checkPlayerAttack() {
     }
 }
 
+void Game::onEnemyKilled(Enemy& enemy) {
+    particleSystem.addExplosion(enemy.getPosition(), ORANGE, 10);
+    decals.stamp(DecalType::BLOOD, Vector2{enemy.getPosition().x + 16, enemy.getPosition().y + 20}, 16.0f);
+    int expReward = enemy.getLevel() * 25;
+    player->gainExperience(expReward);
+    score += enemy.getLevel() * 100;
+    enemiesKilled++;
+
+    addDamageNumber(Vector2{enemy.getPosition().x + 15, enemy.getPosition().y - 15},
+                    expReward, YELLOW);
+    generateItemDrops(&enemy);
+
+    journal.recordKill((int)enemy.getEnemyType(), enemy.getSnapshotIndex(), enemy.getPosition().x, enemy.getPosition().y,
+                       score, enemiesKilled, player->getExperience());
+
+    // TAMING SYSTEM - Chance to tame Shadow Paladin at level 35+
+    if (enemy.getEnemyType() == EnemyType::FALLEN_SHADOW_PALADIN &&
+        player->getLevel() >= 35 && !companionSystem.hasActiveCompanion()) {
+
+        std::uniform_int_distribution<int> tamingChance(1, 100);
+        if (tamingChance(rng) <= 30) { // 30% tame chance
+            companionSystem.tameCompanion(CompanionType::FALLEN_SHADOW_PALADIN, player->getLevel());
+            particleSystem.addMagic(enemy.getPosition(), Color{100, 255, 200, 255}, 20);
+
+            // Show taming message
+            DrawText("TAMED! Shadow Paladin joins you!",
+                    GetScreenWidth() / 2 - 100, 100, 20, Color{0, 255, 136, 255});
+        }
+    }
+
+    // Item drops
+    std::uniform_int_distribution<int> dropChance(1, 100);
+    int chance = dropChance(rng);
+
+    if (chance <= 5) {
+        // 5% - Legendary item
+        std::vector<ItemType> legendaryItems = {
+            ItemType::CLOAK_OF_INVISIBILITY,
+            ItemType::MYSTICAL_RUNE,
+            ItemType::ANCIENT_KEY
+        };
+        std::uniform_int_distribution<int> legendaryDist(0, legendaryItems.size() - 1);
+        ItemType item = legendaryItems[legendaryDist(rng)];
+        player->addItem(ItemSystem::getItemName(item), 1);
+        particleSystem.addMagic(enemy.getPosition(), Color{255, 215, 0, 255}, 12);
+    }
+    else if (chance <= 15) {
+        // 10% - Epic magical item
+        std::vector<ItemType> epicItems = {
+            ItemType::RING_OF_FIRE,
+            ItemType::AMULET_OF_ICE,
+            ItemType::BOOTS_OF_SWIFTNESS,
+            ItemType::MAGIC_ORB,
+            ItemType::SHIELD_PENDANT
+        };
+        std::uniform_int_distribution<int> epicDist(0, epicItems.size() - 1);
+        ItemType item = epicItems[epicDist(rng)];
+        player->addItem(ItemSystem::getItemName(item), 1);
+        particleSystem.addMagic(enemy.getPosition(), Color{200, 0, 200, 255}, 10);
+    }
+    else if (chance <= 25) {
+        // 10% - Weapon drop
+        std::vector<ItemType> weapons = {
+            // ItemType::IRON_KATANA,
+            // ItemType::STEEL_DAGGER,
+            ItemType::THROWING_KNIFE,
+            ItemType::SHURIKEN
+        };
+        std::uniform_int_distribution<int> weaponDist(0, weapons.size() - 1);
+        ItemType weapon = weapons[weaponDist(rng)];
+        player->addItem(ItemSystem::getItemName(weapon), 1);
+        particleSystem.addMagic(enemy.getPosition(), Color{192, 192, 192, 255}, 8);
+    }
+    else if (chance <= 50) {
+        // 25% - Food items
+        std::vector<ItemType> foodItems = {
+            ItemType::MEAT,
+            ItemType::APPLE,
+            ItemType::BREAD,
+            ItemType::CHEESE
+        };
+        std::uniform_int_distribution<int> foodDist(0, foodItems.size() - 1);
+        ItemType food = foodItems[foodDist(rng)];
+        int quantity = foodDist(rng) % 3 + 1; // 1-3 quantity
+        player->addItem(ItemSystem::getItemName(food), quantity);
+        particleSystem.addHeal(enemy.getPosition(), 5);
+    }
+    else if (chance <= 70) {
+        // 20% - Potion drops
+        std::vector<ItemType> potions = {
+            ItemType::HEALTH_POTION,
+            ItemType::SPEED_POTION,
+            ItemType::STEALTH_POTION,
+            ItemType::RAGE_POTION,
+            ItemType::MANA_POTION
+        };
+        std::uniform_int_distribution<int> potionDist(0, potions.size() - 1);
+        ItemType potion = potions[potionDist(rng)];
+        player->addItem(ItemSystem::getItemName(potion), 1);
+    }
+}
+
 void Game::checkCollisions() {
     for (auto& enemy : enemies) {
         if (!enemy->getIsAlive() || !player->getIsAlive()) continue;
@@ -490,7 +679,9 @@ void Game::spawnEnemies() {
 
     if (toSpawn <= 0) return;
 
-    std::vector<Vector2> spawnPositions = gameMap->getSpawnPositions(toSpawn);
+    Vector2 playerPos = player->getPosition();
+    std::vector<Vector2> spawnPositions = gameMap->getSpawnPositions(
+        toSpawn, Vector2{playerPos.x + 16, playerPos.y + 16}, Config::SPAWN_MIN_PLAYER_DISTANCE);
 
     for (int i = 0; i < toSpawn; i++) {
         EnemyType type = selectEnemyType(player->getLevel());
@@ -504,69 +695,8 @@ void Game::spawnEnemies() {
 }
 
 EnemyType Game::selectEnemyType(int playerLevel) {
-    std::vector<EnemyType> availableTypes;
-
-    // Tier D (Always available)
-    if (playerLevel >= 1)
-    availableTypes.insert(availableTypes.end(), {
-        EnemyType::GOBLIN, EnemyType::SKELETON, EnemyType::SLIME,
-    });
-
-    if (playerLevel >= 5)
-        availableTypes.insert(availableTypes.end(), {
-            EnemyType::BAT, EnemyType::FIRE_SPIRIT, EnemyType::DARK_SPIRIT, EnemyType::LIGHT_SPIRIT
-        });
-
-    if (playerLevel >= 8)
-        availableTypes.insert(availableTypes.end(), {
-            EnemyType::HOUND, EnemyType::SALAMANDER_MAN
-        });
-
-    // Tier C (Level 10+)
-    if (playerLevel >= 10) {
-        availableTypes.insert(availableTypes.end(), {
-            EnemyType::CHIMERA_ANT, EnemyType::WEREWOLF, EnemyType::CERBERUS, EnemyType::HONEY_BEE
-        });
-    }
-
-    if (playerLevel >= 12) {
-        availableTypes.insert(availableTypes.end(), {
-            EnemyType::CYCLOPS, EnemyType::MINOTAUR, EnemyType::STONE_GOLEM, EnemyType::ANCIENT_MUMMY
-        });
-    }
-
-    if (playerLevel >= 15) {
-        std::uniform_int_distribution<int> bossChance(1, 100);
-        if (bossChance(rng) <= 5) { // 5% chance for Shadow Paladin
-            return EnemyType::FALLEN_SHADOW_PALADIN;
-        }
-        availableTypes.insert(availableTypes.end(), {
-            EnemyType::IMP, EnemyType::ELF_GIRL, EnemyType::SKELETON_KNIGHT, EnemyType::WITCH
-        });
-    }
-
-    if (playerLevel >= 18) {
-        availableTypes.insert(availableTypes.end(), {
-            EnemyType::MAGE, EnemyType::GOBLIN_GIANT, EnemyType::LAVA_GOLEM
-        });
-    }
-
-    if (playerLevel >= 20) {
-        std::uniform_int_distribution<int> bossChance(1, 100);
-        if (bossChance(rng) <= 5) { // 5% chance for Shadow Paladin
-            return EnemyType::HARPY_QUEEN;
-        }
-    }
-
-    if (playerLevel >= 25) {
-        std::uniform_int_distribution<int> bossChance(1, 100);
-        if (bossChance(rng) <= 5) {
-            return EnemyType::NECROMANCER;
-        }
-    }
-
-    std::uniform_int_distribution<size_t> dist(0, availableTypes.size() - 1);
-    return availableTypes[dist(rng)];
+    spawnTable.buildForFloor(currentFloor);
+    return spawnTable.sample(playerLevel, rng);
 }
 
 int Game::calculateMaxEnemies() const {
@@ -588,8 +718,10 @@ void Game::castFireball() {
             enemy->takeDamage(damage);
             enemy->flashHit(0.15f);
             particleSystem.addMagic(enemy->getPosition(), ORANGE, 10);
-            damageNumbers.emplace_back(Vector2{enemy->getPosition().x, enemy->getPosition().y - 12},
-                                      damage, ORANGE);
+            effectSystem.addFireball(Vector2{enemy->getPosition().x + 16, enemy->getPosition().y + 16});
+            decals.stamp(DecalType::SCORCH, Vector2{enemy->getPosition().x + 16, enemy->getPosition().y + 24}, 14.0f);
+            addDamageNumber(Vector2{enemy->getPosition().x, enemy->getPosition().y - 12},
+                            damage, ORANGE);
         }
     }
 
@@ -633,10 +765,13 @@ void Game::castChainLightning() {
         nearest->takeDamage(damage);
         nearest->flashHit(0.1f);
         particleSystem.addMagic(nearest->getPosition(), YELLOW, 10);
-        damageNumbers.emplace_back(Vector2{nearest->getPosition().x, nearest->getPosition().y - 12},
-                                  damage, YELLOW);
+        effectSystem.addChainLightning(currentPos,
+                                       Vector2{nearest->getPosition().x + 16, nearest->getPosition().y + 16});
+        decals.stamp(DecalType::SCORCH, Vector2{nearest->getPosition().x + 16, nearest->getPosition().y + 24}, 8.0f);
+        addDamageNumber(Vector2{nearest->getPosition().x, nearest->getPosition().y - 12},
+                        damage, YELLOW);
 
-        currentPos = {nearest->getPosition().x + 8, nearest->getPosition().y + 8};
+        currentPos = {nearest->getPosition().x + 16, nearest->getPosition().y + 16};
         availableTargets.erase(std::remove(availableTargets.begin(), availableTargets.end(), nearest),
                               availableTargets.end());
     }
@@ -665,13 +800,15 @@ void Game::castFrostWave() {
         if (dx * dx + dy * dy <= radius * radius) {
             enemy->takeDamage(damage);
             enemy->flashHit(0.2f);
-            enemy->applyKnockback(playerPos, 15.0f);
+            knockBackEnemy(*enemy, playerPos, 15.0f);
             particleSystem.addMagic(enemy->getPosition(), SKYBLUE, 8);
-            damageNumbers.emplace_back(Vector2{enemy->getPosition().x, enemy->getPosition().y - 12},
-                                      damage, SKYBLUE);
+            addDamageNumber(Vector2{enemy->getPosition().x, enemy->getPosition().y - 12},
+                            damage, SKYBLUE);
         }
     }
 
+    effectSystem.addFrostWave(Vector2{playerPos.x + 16, playerPos.y + 16});
+    decals.stamp(DecalType::FROST, Vector2{playerPos.x + 16, playerPos.y + 16}, 48.0f);
     player->castSpell(SpellType::FROST_NOVA);
     cameraShakeTime = 0.12f;
     cameraShakeIntensity = 6.0f;
@@ -697,13 +834,15 @@ void Game::castWhirlwind() {
         if (dx * dx + dy * dy <= radius * radius) {
             enemy->takeDamage(damage);
             enemy->flashHit(0.1f);
-            enemy->applyKnockback(playerPos, 25.0f);
+            knockBackEnemy(*enemy, playerPos, 25.0f);
             particleSystem.addExplosion(enemy->getPosition(), RED, 8);
-            damageNumbers.emplace_back(Vector2{enemy->getPosition().x, enemy->getPosition().y - 12},
-                                      damage, RED);
+            decals.stamp(DecalType::BLOOD, Vector2{enemy->getPosition().x + 16, enemy->getPosition().y + 24}, 8.0f);
+            addDamageNumber(Vector2{enemy->getPosition().x, enemy->getPosition().y - 12},
+                            damage, RED);
         }
     }
 
+    effectSystem.addWhirlwind(Vector2{playerPos.x + 16, playerPos.y + 16});
     player->castSpell(SpellType::WHIRLWIND);
     cameraShakeTime = 0.15f;
     cameraShakeIntensity = 8.0f;
@@ -711,18 +850,49 @@ void Game::castWhirlwind() {
 
 void Game::generateNewFloor() {
     currentFloor++;
-    gameMap->generateFloor(currentFloor);
+    buildFloor(currentFloor, floorSeedFor(currentFloor));
+    spawnTable.buildForFloor(currentFloor);
     enemies.clear();
-    damageNumbers.clear();
+    clearDamageNumbers();
+    effectSystem.clear();
+    decals.clear();
+    projectiles.clear();
 
     Vector2 newPos = gameMap->getRandomSpawnPosition();
     player->setPosition(newPos);
+    updateFieldOfView();
+    journal.recordFloor(currentFloor, gameMap->getFloorSeed(), gameMap->getLayoutChecksum(), newPos.x, newPos.y);
 
     spawnEnemies();
+    requestAutosave();
 
     std::cout << "Entered Floor " << currentFloor << std::endl;
 }
 
+void Game::buildFloor(int floor, uint32_t seed) {
+    // Floors derive from (run seed, floor), so one this run already built
+    // comes back from the cache instead of the generator
+    std::vector<Color> lightmap;
+    int lightCount = 0;
+    if (floorCache.restore(*gameMap, runSeed, floor, seed, lightmap, lightCount)) {
+        lighting.adoptLightmap(*gameMap, std::move(lightmap), lightCount);
+        return;
+    }
+
+    PreparedFloor prepared;
+    if (floorPrefetcher.take(runSeed, floor, seed, prepared) && gameMap->importFloor(prepared.snapshot)) {
+        floorCache.store(runSeed, floor, std::move(prepared.snapshot), prepared.lightmap, prepared.lightCount);
+        lighting.adoptLightmap(*gameMap, std::move(prepared.lightmap), prepared.lightCount);
+        return;
+    }
+
+    // Bake the lightmap now rather than on the next draw, so the cache has it
+    gameMap->generateFloor(floor, seed);
+    lightCount = LightingSystem::bakeLightmap(*gameMap, lightmap);
+    floorCache.store(*gameMap, runSeed, floor, lightmap, lightCount);
+    lighting.adoptLightmap(*gameMap, std::move(lightmap), lightCount);
+}
+
 void Game::generateItemDrops(Enemy* enemy) {
     std::uniform_int_distribution<int> dropChance(1, 100);
     int chance = dropChance(rng);
@@ -795,11 +965,32 @@ void Game::generateItemDrops(Enemy* enemy) {
 void Game::draw() {
     BeginDrawing();
     ClearBackground(Color{20, 20, 30, 255});
+    QuadBatch::beginFrame();
+
+    // Paint this frame's decal stamps before the camera is applied
+    decals.flush(*gameMap);
 
     BeginMode2D(camera);
 
-    // Draw map
+    Vector2 viewTopLeft = GetScreenToWorld2D(Vector2{0, 0}, camera);
+    Vector2 viewBottomRight = GetScreenToWorld2D(Vector2{(float)GetScreenWidth(), (float)GetScreenHeight()}, camera);
+    Rectangle view = {viewTopLeft.x, viewTopLeft.y, viewBottomRight.x - viewTopLeft.x, viewBottomRight.y - viewTopLeft.y};
+
+    // Draw map and decals, light them, then fog over everything the player can't currently see
     gameMap->draw();
+    decals.draw(view);
+
+    Vector2 playerPos = player->getPosition();
+    lighting.beginFrame();
+    lighting.addDynamicLight(Vector2{playerPos.x + 16, playerPos.y + 16}, 140.0f, Color{255, 200, 140, 60});
+    effectSystem.addLights(lighting);
+    lighting.draw(*gameMap);
+
+    fieldOfView.drawFog(view);
+
+    if (showDistanceField) {
+        drawDistanceField(view);
+    }
 
     // Draw companion
     companionSystem.drawCompanion();
@@ -817,15 +1008,18 @@ void Game::draw() {
         DrawRectangleLinesEx(attackRange, 3, RED);
     }
 
-    // Draw enemies
+    // Draw enemies (only those in view)
     for (const auto& enemy : enemies) {
-        if (enemy->getIsAlive()) {
+        if (enemy->getIsAlive() && enemy->isInPlayerView()) {
             enemy->draw();
         }
     }
 
+    projectiles.draw(view);
+
     // Draw particles
     particleSystem.draw();
+    effectSystem.draw();
 
     // Draw damage numbers
     drawDamageNumbers();
@@ -835,6 +1029,10 @@ void Game::draw() {
     // Draw HUD
     hud->draw(this, player.get());
 
+    if (showDebugOverlay) {
+        drawDebugOverlay();
+    }
+
     if (gameOver) {
         drawGameOver();
     } else if (isPaused) {
@@ -870,9 +1068,82 @@ void Game::drawCompanionInfo() {
 }
 
 void Game::drawDamageNumbers() {
-    for (const auto& damage : damageNumbers) {
-        std::string text = "-" + std::to_string(damage.damage);
-        DrawText(text.c_str(), (int)damage.position.x, (int)damage.position.y, 16, damage.color);
+    for (int i = 0; i < damageNumberCount; i++) {
+        const DamageNumber& damage = damageNumbers[(damageNumberHead + i) % Config::MAX_DAMAGE_NUMBERS];
+        Vector2 position = {(float)(int)damage.position.x, (float)(int)damage.position.y};
+
+        if (TextAtlas::isReady()) {
+            TextAtlas::drawNegativeNumber(damage.damage, position, damage.color);
+        } else {
+            DrawText(TextFormat("-%d", damage.damage), (int)position.x, (int)position.y, 16, damage.color);
+        }
+    }
+}
+
+void Game::drawDebugOverlay() {
+    int x = 10;
+    int y = GetScreenHeight() - 236;
+    int lineHeight = 14;
+
+    DrawRectangle(x - 5, y - 5, 260, 13 * lineHeight + 10, Fade(BLACK, 0.7f));
+    DrawText(TextFormat("FPS: %d", GetFPS()), x, y, 10, LIME);
+    y += lineHeight;
+    DrawText(TextFormat("Particles: %d / %d", particleSystem.getParticleCount(), particleSystem.getCapacity()),
+             x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Effects: %d", effectSystem.getEffectCount()), x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Projectiles: %d / %d", projectiles.getProjectileCount(), projectiles.getCapacity()),
+             x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Visible tiles: %d", fieldOfView.getVisibleCount()), x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Lights: %d baked, %d dynamic", lighting.getBakedLightCount(), lighting.getDynamicLightCount()),
+             x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Decal chunks: %d", decals.getAllocatedChunkCount()), x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Wall rects: %d for %d tiles", (int)gameMap->getWallRects().size(), gameMap->getWallTileCount()),
+             x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Quad vertices: %d", QuadBatch::getFrameVertices()), x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Quad batches: %d", QuadBatch::getFrameBatches()), x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Save journal: %d bytes, epoch %u", (int)journal.getSize(), journal.getEpoch()), x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Floor cache: %d hits, %d from disk, %d misses", floorCache.getHits(),
+                        floorCache.getSpillHits(), floorCache.getMisses()),
+             x, y, 10, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("Floor prefetch: %d used of %d built%s", floorPrefetcher.getUsedCount(),
+                        floorPrefetcher.getPreparedCount(), floorPrefetcher.isWorking() ? ", building" : ""),
+             x, y, 10, WHITE);
+}
+
+void Game::drawDistanceField(Rectangle view) {
+    // Heatmap of wall distance: red at the walls fading to blue four tiles out
+    const std::vector<float>& field = gameMap->getWallDistanceField();
+    int fieldWidth = gameMap->getDistanceFieldWidth();
+    int fieldHeight = gameMap->getDistanceFieldHeight();
+    float cellSize = gameMap->getDistanceFieldCellSize();
+    if (field.empty()) return;
+
+    int minX = std::max(0, (int)(view.x / cellSize));
+    int minY = std::max(0, (int)(view.y / cellSize));
+    int maxX = std::min(fieldWidth - 1, (int)((view.x + view.width) / cellSize));
+    int maxY = std::min(fieldHeight - 1, (int)((view.y + view.height) / cellSize));
+    float range = 4.0f * gameMap->getTileSize();
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            float distance = field[(size_t)y * fieldWidth + x];
+            if (distance <= 0.0f) continue;
+
+            float t = std::min(1.0f, distance / range);
+            Color color = Color{(unsigned char)(255 * (1.0f - t)), 0, (unsigned char)(255 * t), 110};
+            DrawRectangleRec(Rectangle{x * cellSize, y * cellSize, cellSize, cellSize}, color);
+        }
     }
 }
 
@@ -929,6 +1200,13 @@ void Game::drawPauseMenu() {
 void Game::saveGame() {
     if (!player) return;
 
+    // One snapshot in flight at a time: the journal chain on disk only
+    // covers a single snapshot that hasn't landed yet
+    if (saveWorker.isSaving()) {
+        autosavePending = true;
+        return;
+    }
+
     saveData.playerLevel = player->getLevel();
     saveData.playerHealth = player->getHealth();
     saveData.playerMaxHealth = player->getMaxHealth();
@@ -940,8 +1218,11 @@ void Game::saveGame() {
     saveData.currentWeapon = player->getWeapon().name;
     saveData.highestFloor = std::max(saveData.highestFloor, currentFloor);
     saveData.lastSaveTime = SaveSystem::getCurrentTimestamp();
+    saveData.exploredFloor = currentFloor;
+    saveData.exploredTiles = fieldOfView.exportExplored();
 
-    // Save inventory
+    // Save inventory; counts left over from an earlier save must not survive
+    saveData.potions = PotionInventory{};
     for (const auto& item : player->getInventory()) {
         if (item.name == "Health Potion") saveData.potions.healthPotions = item.quantity;
         else if (item.name == "Speed Potion") saveData.potions.speedPotions = item.quantity;
@@ -949,24 +1230,149 @@ void Game::saveGame() {
         else if (item.name == "Rage Potion") saveData.potions.ragePotions = item.quantity;
     }
 
-    SaveSystem::save(saveData, Config::SAVE_FILE);
-    std::cout << "Game saved! Floor " << currentFloor << ", Level " << player->getLevel() << std::endl;
+    // Full run state, enough to rebuild this exact moment on load
+    saveData.hasRunState = true;
+    saveData.runSeed = runSeed;
+    saveData.floorSeed = gameMap->getFloorSeed();
+    saveData.layoutChecksum = gameMap->getLayoutChecksum();
+    saveData.playerX = player->getPosition().x;
+    saveData.playerY = player->getPosition().y;
+
+    saveData.inventory.clear();
+    for (const auto& item : player->getInventory()) {
+        saveData.inventory.push_back({item.name, item.quantity});
+    }
+    saveData.equippedItems.clear();
+    for (ItemType item : player->getEquippedItems()) {
+        saveData.equippedItems.push_back((int)item);
+    }
+    saveData.spells.clear();
+    for (const auto& spell : player->getSpells()) {
+        saveData.spells.push_back({(int)spell.type, spell.lastCastTime});
+    }
+    saveData.speedBuffTime = player->getSpeedBuffTime();
+    saveData.stealthBuffTime = player->getStealthBuffTime();
+    saveData.rageBuffTime = player->getRageBuffTime();
+
+    // Kills journaled after this snapshot name the enemy by its index here
+    saveData.enemies.clear();
+    for (const auto& enemy : enemies) {
+        if (!enemy->getIsAlive()) continue;
+        enemy->setSnapshotIndex((int)saveData.enemies.size());
+        saveData.enemies.push_back({(int)enemy->getEnemyType(), enemy->getLevel(), enemy->getHealth(),
+                                    enemy->getPosition().x, enemy->getPosition().y});
+    }
+
+    saveData.companion = SavedCompanion{};
+    if (companionSystem.hasActiveCompanion()) {
+        const Companion* companion = companionSystem.getCompanion();
+        saveData.companion = {(int)companion->getType(), companion->getLevel(), companion->getHealth(),
+                              companion->getPosition().x, companion->getPosition().y};
+    }
+
+    // Only the snapshot is taken here; encoding and the disk write happen on
+    // the save worker. The JSON export is what the web dashboard reads.
+    // The snapshot includes every event so far, so it compacts the journal
+    saveData.journalEpoch++;
+    saveWorker.request(saveData, saveSlot);
+    journal.rotate(saveData.journalEpoch);
+    journaledLevel = player->getLevel();
+    journaledInventory = player->getInventory();
+    journaledInventoryVersion = player->getInventoryVersion();
+    autosaveTimer = 0;
+    std::cout << "Saving game... Floor " << currentFloor << ", Level " << player->getLevel() << std::endl;
 }
 
-void Game::loadGame() {
-    if (!SaveSystem::load(saveData, Config::SAVE_FILE)) {
+void Game::updateAutosave(float deltaTime) {
+    autosaveTimer += deltaTime;
+
+    if (player->getLevel() != journaledLevel) {
+        journaledLevel = player->getLevel();
+        journal.recordLevel(journaledLevel, player->getExperience());
+    }
+    if (player->getInventoryVersion() != journaledInventoryVersion) {
+        journalInventoryChanges();
+    }
+
+    if (journal.getSize() >= (std::size_t)Config::SAVE_JOURNAL_COMPACT_BYTES) {
+        requestAutosave();
+    }
+
+    // Events that fire in the same frame share one save
+    if (player->getIsAlive() && (autosavePending || autosaveTimer >= Config::AUTOSAVE_INTERVAL)) {
+        autosavePending = false;
+        saveGame();
+    }
+}
+
+void Game::journalInventoryChanges() {
+    const auto& inventory = player->getInventory();
+
+    // Inventories hold a couple dozen stacks at most, a linear diff is fine
+    for (const auto& item : inventory) {
+        auto it = std::find_if(journaledInventory.begin(), journaledInventory.end(),
+                               [&item](const InventoryItem& old) { return old.name == item.name; });
+        if (it == journaledInventory.end() || it->quantity != item.quantity) {
+            journal.recordItem(item.name, item.quantity);
+        }
+    }
+    for (const auto& old : journaledInventory) {
+        auto it = std::find_if(inventory.begin(), inventory.end(),
+                               [&old](const InventoryItem& item) { return item.name == old.name; });
+        if (it == inventory.end()) {
+            journal.recordItem(old.name, 0);
+        }
+    }
+
+    journaledInventory = inventory;
+    journaledInventoryVersion = player->getInventoryVersion();
+}
+
+bool Game::hasSaveFile() const {
+    return SaveSystem::slotExists(saveSlot);
+}
+
+void Game::setSaveSlot(int slot) {
+    saveSlot = slot;
+    slotFiles = SaveSystem::getSlotFiles(slot);
+    journal.setFiles(slotFiles.journal, slotFiles.previousJournal);
+}
+
+uint32_t Game::floorSeedFor(int floor) const {
+    // Mix the run seed with the floor number so neighbouring floors get
+    // unrelated layouts but the same run always replays the same dungeon
+    uint32_t x = runSeed + (uint32_t)floor * 0x9E3779B9u;
+    x ^= x >> 16;
+    x *= 0x7FEB352Du;
+    x ^= x >> 15;
+    x *= 0x846CA68Bu;
+    x ^= x >> 16;
+    return x;
+}
+
+bool Game::readSaveData() {
+    // Older builds only wrote the JSON file; it is also the last resort if
+    // both binary saves are damaged
+    if (SaveSystem::load(saveData, slotFiles.save, slotFiles.backup)) {
+        // Events recorded after the snapshot
+        SaveJournal::replay(saveData, slotFiles.journal, slotFiles.previousJournal);
+        return true;
+    }
+    if (!saveData.fromJSON(slotFiles.exportJSON)) {
         std::cout << "No save file found, starting new game" << std::endl;
-        return;
+        return false;
     }
+    return true;
+}
 
+void Game::applySaveData() {
     if (!player) {
         std::cout << "Player not initialized, cannot load" << std::endl;
         return;
     }
 
-    // Load player name
-    player->playerName = saveData.playerName;  // ← ADD THIS
-
+    player->playerName = saveData.playerName;
+    player->restoreProgress(saveData.playerLevel, saveData.playerExperience);
     player->setHealth(saveData.playerHealth);
 
     score = saveData.score;
@@ -974,16 +1380,112 @@ void Game::loadGame() {
     currentFloor = saveData.currentFloor;
     gameTime = saveData.playTime;
 
+    if (saveData.hasRunState) {
+        runSeed = saveData.runSeed;
+
+        // initialize() already built the floor from the saved seed; only
+        // regenerate if something else was generated in between
+        if (gameMap->getFloorSeed() != saveData.floorSeed) {
+            buildFloor(currentFloor, saveData.floorSeed);
+            spawnTable.buildForFloor(currentFloor);
+            decals.clear();
+            projectiles.clear();
+            effectSystem.clear();
+        }
+
+        // Same seed, different walls: the generator changed since this save
+        // was written. Positions no longer line up with the layout.
+        bool layoutMatches = gameMap->getLayoutChecksum() == saveData.layoutChecksum;
+        if (!layoutMatches) {
+            std::cout << "Warning: floor layout differs from the save, respawning entities" << std::endl;
+        }
+
+        Vector2 savedPos = {saveData.playerX, saveData.playerY};
+        if (layoutMatches && !gameMap->circleHitsWall({savedPos.x + 16, savedPos.y + 16}, 8)) {
+            player->setPosition(savedPos);
+        } else {
+            player->setPosition(gameMap->getRandomSpawnPosition());
+        }
+
+        std::vector<InventoryItem> items;
+        items.reserve(saveData.inventory.size());
+        for (const auto& item : saveData.inventory) {
+            if (item.quantity > 0) items.push_back({item.name, item.quantity});
+        }
+        player->setInventory(std::move(items));
+
+        for (int item : saveData.equippedItems) {
+            if (item >= 0 && item < (int)ItemType::COUNT) {
+                player->equipItem((ItemType)item);
+            }
+        }
+
+        for (const auto& spell : saveData.spells) {
+            player->setSpellCooldownElapsed((SpellType)spell.type, spell.sinceCast);
+        }
+
+        if (saveData.speedBuffTime > 0) player->applySpeedBuff(saveData.speedBuffTime);
+        if (saveData.stealthBuffTime > 0) player->applyStealthBuff(saveData.stealthBuffTime);
+        if (saveData.rageBuffTime > 0) player->applyRageBuff(saveData.rageBuffTime);
+
+        // An empty list means the journal moved to a floor with no saved enemies
+        // yet; keep the ones initialize() spawned
+        if (layoutMatches && !saveData.enemies.empty()) {
+            enemies.clear();
+            for (size_t i = 0; i < saveData.enemies.size(); i++) {
+                const SavedEnemy& saved = saveData.enemies[i];
+                if (saved.type < 0 || saved.type > (int)EnemyType::NECROMANCER) continue;
+                auto enemy = Enemy::create((EnemyType)saved.type, saved.level);
+                if (enemy) {
+                    enemy->setPosition({saved.x, saved.y});
+                    enemy->setHealth(saved.health);
+                    enemy->setSnapshotIndex((int)i);
+                    enemies.push_back(std::move(enemy));
+                }
+            }
+        }
+
+        companionSystem.releaseCompanion();
+        if (saveData.companion.type != (int)CompanionType::NONE && saveData.companion.health > 0) {
+            companionSystem.tameCompanion((CompanionType)saveData.companion.type, saveData.companion.level);
+            Companion* companion = companionSystem.getCompanion();
+            companion->setHealth(saveData.companion.health);
+            companion->setPosition(layoutMatches ? Vector2{saveData.companion.x, saveData.companion.y}
+                                                 : player->getPosition());
+        }
+    } else {
+        // Legacy saves only recorded potion counts
+        const PotionInventory& potions = saveData.potions;
+        if (potions.healthPotions > 0) player->addItem("Health Potion", potions.healthPotions);
+        if (potions.speedPotions > 0) player->addItem("Speed Potion", potions.speedPotions);
+        if (potions.stealthPotions > 0) player->addItem("Stealth Potion", potions.stealthPotions);
+        if (potions.ragePotions > 0) player->addItem("Rage Potion", potions.ragePotions);
+    }
+
+    if (saveData.exploredFloor == currentFloor && !saveData.exploredTiles.empty()) {
+        fieldOfView.importExplored(*gameMap, saveData.exploredTiles);
+    }
+    updateFieldOfView();
+    camera.target = player->getPosition();
+
     std::cout << "Game loaded! Player: " << player->playerName << " | Floor " << currentFloor << ", Level " << player->getLevel() << std::endl;
 }
 
 void Game::cleanup() {
+    // Let an in-flight save reach the disk before shutting down
+    saveWorker.waitIdle();
+    journal.close();
+
     enemies.clear();
-    damageNumbers.clear();
+    clearDamageNumbers();
     player.reset();
     gameMap.reset();
     hud.reset();
+    lighting.unload();
+    decals.unload();
 
+    TextAtlas::shutdown();
+    QuadBatch::shutdown();
     CloseWindow();
     std::cout << "Game cleanup completed" << std::endl;
 }
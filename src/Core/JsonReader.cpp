@@ -0,0 +1,296 @@
+#include "JsonReader.h"
+#include <charconv>
+#include <cstring>
+
+JsonReader::JsonReader(const char* data, std::size_t size)
+    : begin(data), pos(data), end(data + size), textEscaped(false),
+      expect(Expect::VALUE), depth(0), inObject(), error(nullptr) {}
+
+JsonToken JsonReader::fail(const char* message) {
+    if (!error) error = message;
+    return JsonToken::ERROR;
+}
+
+void JsonReader::skipWhitespace() {
+    while (pos < end && (*pos == ' ' || *pos == '\n' || *pos == '\r' || *pos == '\t')) {
+        pos++;
+    }
+}
+
+JsonToken JsonReader::next() {
+    if (error) return JsonToken::ERROR;
+
+    skipWhitespace();
+    if (pos == end) {
+        if (depth == 0 && expect == Expect::SEPARATOR) return JsonToken::END;
+        return fail("unexpected end of input");
+    }
+
+    char c = *pos;
+    switch (expect) {
+        case Expect::SEPARATOR:
+            if (depth == 0) return fail("unexpected data after the document");
+            if (c == '}' || c == ']') return close(c);
+            if (c != ',') return fail("expected ',' or a closing bracket");
+            pos++;
+            skipWhitespace();
+            if (pos == end) return fail("unexpected end of input");
+            c = *pos;
+            if (!inObject[depth - 1]) return readValue();
+            [[fallthrough]];
+        case Expect::KEY:
+            if (c != '"') return fail("expected a key");
+            if (!scanString()) return JsonToken::ERROR;
+            skipWhitespace();
+            if (pos == end || *pos != ':') return fail("expected ':' after a key");
+            pos++;
+            expect = Expect::VALUE;
+            return JsonToken::KEY;
+        case Expect::KEY_OR_CLOSE:
+            if (c == '}') return close(c);
+            expect = Expect::KEY;
+            return next();
+        case Expect::VALUE_OR_CLOSE:
+            if (c == ']') return close(c);
+            return readValue();
+        case Expect::VALUE:
+            return readValue();
+    }
+    return fail("invalid reader state");
+}
+
+JsonToken JsonReader::readValue() {
+    char c = *pos;
+
+    if (c == '{' || c == '[') {
+        if (depth == MAX_DEPTH) return fail("nesting too deep");
+        pos++;
+        bool object = c == '{';
+        inObject[depth++] = object;
+        expect = object ? Expect::KEY_OR_CLOSE : Expect::VALUE_OR_CLOSE;
+        return object ? JsonToken::BEGIN_OBJECT : JsonToken::BEGIN_ARRAY;
+    }
+
+    expect = Expect::SEPARATOR;
+    if (c == '"') {
+        return scanString() ? JsonToken::STRING : JsonToken::ERROR;
+    }
+    if (c == '-' || (c >= '0' && c <= '9')) {
+        return scanNumber() ? JsonToken::NUMBER : JsonToken::ERROR;
+    }
+    if (c == 't') return scanLiteral("true") ? JsonToken::TRUE_VALUE : JsonToken::ERROR;
+    if (c == 'f') return scanLiteral("false") ? JsonToken::FALSE_VALUE : JsonToken::ERROR;
+    if (c == 'n') return scanLiteral("null") ? JsonToken::NULL_VALUE : JsonToken::ERROR;
+    return fail("unexpected character");
+}
+
+JsonToken JsonReader::close(char bracket) {
+    bool object = bracket == '}';
+    if (depth == 0 || inObject[depth - 1] != object) return fail("mismatched closing bracket");
+    pos++;
+    depth--;
+    expect = Expect::SEPARATOR;
+    return object ? JsonToken::END_OBJECT : JsonToken::END_ARRAY;
+}
+
+bool JsonReader::scanString() {
+    const char* start = ++pos;  // Past the opening quote
+    textEscaped = false;
+
+    while (pos < end) {
+        char c = *pos;
+        if (c == '"') {
+            text = std::string_view(start, (std::size_t)(pos - start));
+            pos++;
+            return true;
+        }
+        if (c == '\\') {
+            if (end - pos < 2) break;
+            textEscaped = true;
+            pos += 2;
+            continue;
+        }
+        if ((unsigned char)c < 0x20) {
+            fail("control character in string");
+            return false;
+        }
+        pos++;
+    }
+
+    fail("unterminated string");
+    return false;
+}
+
+bool JsonReader::scanNumber() {
+    const char* start = pos;
+    auto digits = [this] {
+        const char* first = pos;
+        while (pos < end && *pos >= '0' && *pos <= '9') pos++;
+        return pos > first;
+    };
+
+    if (*pos == '-') pos++;
+    bool valid = digits();
+    if (valid && pos < end && *pos == '.') {
+        pos++;
+        valid = digits();
+    }
+    if (valid && pos < end && (*pos == 'e' || *pos == 'E')) {
+        pos++;
+        if (pos < end && (*pos == '+' || *pos == '-')) pos++;
+        valid = digits();
+    }
+
+    if (!valid) {
+        fail("malformed number");
+        return false;
+    }
+    text = std::string_view(start, (std::size_t)(pos - start));
+    return true;
+}
+
+bool JsonReader::scanLiteral(std::string_view literal) {
+    if ((std::size_t)(end - pos) < literal.size() || std::memcmp(pos, literal.data(), literal.size()) != 0) {
+        fail("unexpected character");
+        return false;
+    }
+    pos += literal.size();
+    return true;
+}
+
+bool JsonReader::getString(std::string& out) const {
+    if (!textEscaped) {
+        out.assign(text.data(), text.size());
+        return true;
+    }
+
+    out.clear();
+    for (std::size_t i = 0; i < text.size(); i++) {
+        char c = text[i];
+        if (c != '\\') {
+            out += c;
+            continue;
+        }
+        if (++i == text.size()) return false;
+
+        switch (text[i]) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                auto hex4 = [this](std::size_t at, uint32_t& value) {
+                    if (at + 4 > text.size()) return false;
+                    const char* first = text.data() + at;
+                    return std::from_chars(first, first + 4, value, 16).ptr == first + 4;
+                };
+
+                uint32_t code = 0;
+                if (!hex4(i + 1, code)) return false;
+                i += 4;
+
+                // Surrogate pair for characters outside the BMP
+                uint32_t low = 0;
+                if (code >= 0xD800 && code < 0xDC00 && i + 2 < text.size() &&
+                    text[i + 1] == '\\' && text[i + 2] == 'u' && hex4(i + 3, low) &&
+                    low >= 0xDC00 && low < 0xE000) {
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+
+                if (code < 0x80) {
+                    out += (char)code;
+                } else if (code < 0x800) {
+                    out += (char)(0xC0 | (code >> 6));
+                    out += (char)(0x80 | (code & 0x3F));
+                } else if (code < 0x10000) {
+                    out += (char)(0xE0 | (code >> 12));
+                    out += (char)(0x80 | ((code >> 6) & 0x3F));
+                    out += (char)(0x80 | (code & 0x3F));
+                } else {
+                    out += (char)(0xF0 | (code >> 18));
+                    out += (char)(0x80 | ((code >> 12) & 0x3F));
+                    out += (char)(0x80 | ((code >> 6) & 0x3F));
+                    out += (char)(0x80 | (code & 0x3F));
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool JsonReader::getInt(int& out) const {
+    const char* first = text.data();
+    const char* last = first + text.size();
+    int value;
+    auto result = std::from_chars(first, last, value);
+    if (result.ec != std::errc()) return false;
+    if (result.ptr != last) {
+        // "12.0" or "1e3": go through float and truncate
+        float real;
+        if (!getFloat(real)) return false;
+        value = (int)real;
+    }
+    out = value;
+    return true;
+}
+
+bool JsonReader::getFloat(float& out) const {
+    const char* first = text.data();
+    const char* last = first + text.size();
+    float value;
+    auto result = std::from_chars(first, last, value);
+    if (result.ec != std::errc() || result.ptr != last) return false;
+    out = value;
+    return true;
+}
+
+bool JsonReader::skipContainer(JsonToken first) {
+    if (first == JsonToken::ERROR || first == JsonToken::END ||
+        first == JsonToken::END_OBJECT || first == JsonToken::END_ARRAY) {
+        return false;
+    }
+    if (first != JsonToken::BEGIN_OBJECT && first != JsonToken::BEGIN_ARRAY) return true;
+
+    int target = depth - 1;
+    while (depth > target) {
+        if (next() == JsonToken::ERROR) return false;
+    }
+    return true;
+}
+
+bool JsonReader::readString(std::string& out) {
+    JsonToken token = next();
+    if (token == JsonToken::STRING) return getString(out);
+    skipContainer(token);
+    return false;
+}
+
+bool JsonReader::readInt(int& out) {
+    JsonToken token = next();
+    if (token == JsonToken::NUMBER) return getInt(out);
+    skipContainer(token);
+    return false;
+}
+
+bool JsonReader::readFloat(float& out) {
+    JsonToken token = next();
+    if (token == JsonToken::NUMBER) return getFloat(out);
+    skipContainer(token);
+    return false;
+}
+
+int JsonReader::getLine() const {
+    int line = 1;
+    for (const char* p = begin; p < pos; p++) {
+        if (*p == '\n') line++;
+    }
+    return line;
+}
@@ -0,0 +1,339 @@
+#include "SaveJournal.h"
+#include "ByteStream.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+#include <vector>
+
+namespace {
+    constexpr char JOURNAL_MAGIC[4] = {'D', 'C', '2', 'J'};
+    constexpr uint16_t JOURNAL_FORMAT_VERSION = 1;
+    constexpr std::size_t JOURNAL_HEADER_SIZE = 12;
+    constexpr std::size_t RECORD_HEADER_SIZE = 3;  // u8 event, u16 length
+
+    bool readJournal(const std::string& filename, uint32_t& epoch, std::string& bytes) {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return false;
+
+        bytes.assign((std::size_t)file.tellg(), '\0');
+        file.seekg(0);
+        file.read(&bytes[0], (std::streamsize)bytes.size());
+        if (bytes.size() < JOURNAL_HEADER_SIZE || std::memcmp(bytes.data(), JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0) {
+            std::cerr << "Not a save journal: " << filename << std::endl;
+            return false;
+        }
+
+        ByteReader header(bytes.data() + sizeof(JOURNAL_MAGIC), JOURNAL_HEADER_SIZE - sizeof(JOURNAL_MAGIC));
+        uint16_t version, reserved;
+        header.u16(version);
+        header.u16(reserved);
+        header.u32(epoch);
+        return true;
+    }
+
+    void setPotionCount(PotionInventory& potions, const std::string& name, int quantity) {
+        if (name == "Health Potion") potions.healthPotions = quantity;
+        else if (name == "Speed Potion") potions.speedPotions = quantity;
+        else if (name == "Stealth Potion") potions.stealthPotions = quantity;
+        else if (name == "Rage Potion") potions.ragePotions = quantity;
+    }
+
+    struct ReplayState {
+        std::vector<bool> killed;  // Parallel to data.enemies; erased once replay ends
+        bool indicesMatch;         // Kill indices refer to data.enemies, see replay()
+    };
+
+    // The snapshot enemy a KILL record names. Records from before the index
+    // and position were added fall back to the first enemy of the type.
+    int findKilledEnemy(const SaveData& data, const ReplayState& state, int enemyType,
+                        bool hasIndex, int snapshotIndex, float x, float y) {
+        auto alive = [&](int i) { return !state.killed[i] && data.enemies[i].type == enemyType; };
+
+        if (hasIndex && state.indicesMatch) {
+            // -1: spawned after the snapshot, so it was never listed
+            bool listed = snapshotIndex >= 0 && snapshotIndex < (int)data.enemies.size();
+            return listed && alive(snapshotIndex) ? snapshotIndex : -1;
+        }
+        if (hasIndex && snapshotIndex < 0) return -1;
+
+        // The index belongs to a snapshot that never reached the disk; the
+        // nearest enemy of the type to where it died is the best guess
+        int best = -1;
+        float bestDistance = 0;
+        for (int i = 0; i < (int)data.enemies.size(); i++) {
+            if (!alive(i)) continue;
+            if (!hasIndex) return i;
+
+            float dx = data.enemies[i].x - x;
+            float dy = data.enemies[i].y - y;
+            float distance = dx * dx + dy * dy;
+            if (best < 0 || distance < bestDistance) {
+                best = i;
+                bestDistance = distance;
+            }
+        }
+        return best;
+    }
+
+    void applyEvent(SaveData& data, ReplayState& state, JournalEvent event, ByteReader& payload) {
+        switch (event) {
+            case JournalEvent::KILL: {
+                int enemyType = -1;
+                int snapshotIndex = -1;
+                float x = 0, y = 0;
+                payload.i32(enemyType);
+                payload.i32(data.score);
+                payload.i32(data.enemiesKilled);
+                payload.i32(data.playerExperience);
+                bool hasIndex = payload.i32(snapshotIndex) && payload.f32(x) && payload.f32(y);
+
+                // The snapshot still lists the enemy; mark it, so the indices
+                // of later kills keep pointing at the same list
+                int killed = findKilledEnemy(data, state, enemyType, hasIndex, snapshotIndex, x, y);
+                if (killed >= 0) state.killed[killed] = true;
+                break;
+            }
+            case JournalEvent::LEVEL:
+                payload.i32(data.playerLevel);
+                payload.i32(data.playerExperience);
+                break;
+            case JournalEvent::ITEM: {
+                std::string name;
+                int quantity = 0;
+                if (!payload.str(name)) break;
+                payload.i32(quantity);
+
+                auto it = std::find_if(data.inventory.begin(), data.inventory.end(),
+                                       [&name](const SavedItem& item) { return item.name == name; });
+                if (quantity <= 0) {
+                    if (it != data.inventory.end()) data.inventory.erase(it);
+                } else if (it != data.inventory.end()) {
+                    it->quantity = quantity;
+                } else {
+                    data.inventory.push_back({name, quantity});
+                }
+                setPotionCount(data.potions, name, std::max(0, quantity));
+                break;
+            }
+            case JournalEvent::FLOOR:
+                payload.i32(data.currentFloor);
+                payload.u32(data.floorSeed);
+                payload.u32(data.layoutChecksum);
+                payload.f32(data.playerX);
+                payload.f32(data.playerY);
+
+                // A new floor starts unexplored, with its own enemies
+                data.highestFloor = std::max(data.highestFloor, data.currentFloor);
+                data.enemies.clear();
+                state.killed.clear();
+                data.exploredFloor = data.currentFloor;
+                data.exploredTiles.clear();
+                data.companion.x = data.playerX;
+                data.companion.y = data.playerY;
+                break;
+            default:
+                break; // Written by a newer version
+        }
+    }
+
+    int replayRecords(SaveData& data, ReplayState& state, const std::string& bytes) {
+        ByteReader reader(bytes.data() + JOURNAL_HEADER_SIZE, bytes.size() - JOURNAL_HEADER_SIZE);
+        int applied = 0;
+
+        while (reader.remaining() > 0) {
+            const char* start = reader.current();
+            uint8_t event;
+            uint16_t length;
+            uint32_t checksum = 0;
+            if (!reader.u8(event) || !reader.u16(length) || reader.remaining() < (std::size_t)length + 4) break;
+
+            ByteReader payload(reader.current(), length);
+            reader.skip(length);
+            reader.u32(checksum);
+            if (crc32(start, RECORD_HEADER_SIZE + length) != checksum) break;
+
+            applyEvent(data, state, (JournalEvent)event, payload);
+            applied++;
+        }
+
+        // A torn final record is expected after a crash mid-append
+        if (reader.remaining() > 0) {
+            std::cout << "Save journal ends in an incomplete record, ignoring the rest" << std::endl;
+        }
+        return applied;
+    }
+}
+
+SaveJournal::SaveJournal() : file(nullptr), epoch(0), size(0) {
+    record.reserve(64);
+}
+
+SaveJournal::~SaveJournal() {
+    close();
+}
+
+bool SaveJournal::rotate(uint32_t snapshotEpoch) {
+    close();
+
+    std::error_code error;
+    std::filesystem::path target(filename);
+    if (target.has_parent_path()) {
+        std::filesystem::create_directories(target.parent_path(), error);
+    }
+    if (std::filesystem::exists(target, error)) {
+        std::filesystem::rename(target, previousFilename, error);
+        if (error) {
+            std::cerr << "Failed to rotate save journal: " << error.message() << std::endl;
+        }
+    }
+
+    file = std::fopen(filename.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Failed to open save journal: " << filename << std::endl;
+        return false;
+    }
+
+    std::string header(JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    ByteWriter writer(header);
+    writer.u16(JOURNAL_FORMAT_VERSION);
+    writer.u16(0);
+    writer.u32(snapshotEpoch);
+
+    if (std::fwrite(header.data(), 1, header.size(), file) != header.size() || std::fflush(file) != 0) {
+        std::cerr << "Failed to write save journal: " << filename << std::endl;
+        close();
+        return false;
+    }
+
+    epoch = snapshotEpoch;
+    size = header.size();
+    return true;
+}
+
+void SaveJournal::setFiles(const std::string& journalFile, const std::string& previousJournalFile) {
+    close();
+    filename = journalFile;
+    previousFilename = previousJournalFile;
+}
+
+void SaveJournal::close() {
+    if (file) {
+        std::fclose(file);
+        file = nullptr;
+    }
+    size = 0;
+}
+
+bool SaveJournal::deleteFiles() {
+    close();
+    std::error_code error;
+    bool removed = std::filesystem::remove(filename, error);
+    removed = std::filesystem::remove(previousFilename, error) || removed;
+    return removed;
+}
+
+std::string& SaveJournal::beginRecord(JournalEvent event) {
+    record.clear();
+    ByteWriter writer(record);
+    writer.u8((uint8_t)event);
+    writer.u16(0);  // Payload length, patched in endRecord
+    return record;
+}
+
+void SaveJournal::endRecord() {
+    if (!file) return;
+
+    std::size_t length = record.size() - RECORD_HEADER_SIZE;
+    record[1] = (char)(length & 0xFF);
+    record[2] = (char)(length >> 8);
+    ByteWriter writer(record);
+    writer.u32(crc32(record.data(), record.size()));
+
+    if (std::fwrite(record.data(), 1, record.size(), file) != record.size() || std::fflush(file) != 0) {
+        // The next snapshot still captures everything; it just starts a new journal
+        std::cerr << "Failed to append to save journal: " << filename << std::endl;
+        close();
+        return;
+    }
+    size += record.size();
+}
+
+void SaveJournal::recordKill(int enemyType, int snapshotIndex, float x, float y,
+                             int score, int enemiesKilled, int experience) {
+    if (!file) return;
+    ByteWriter writer(beginRecord(JournalEvent::KILL));
+    writer.i32(enemyType);
+    writer.i32(score);
+    writer.i32(enemiesKilled);
+    writer.i32(experience);
+    writer.i32(snapshotIndex);  // Appended after the original fields, so older records still read
+    writer.f32(x);
+    writer.f32(y);
+    endRecord();
+}
+
+void SaveJournal::recordLevel(int level, int experience) {
+    if (!file) return;
+    ByteWriter writer(beginRecord(JournalEvent::LEVEL));
+    writer.i32(level);
+    writer.i32(experience);
+    endRecord();
+}
+
+void SaveJournal::recordItem(const std::string& name, int quantity) {
+    if (!file) return;
+    ByteWriter writer(beginRecord(JournalEvent::ITEM));
+    writer.str(name);
+    writer.i32(quantity);
+    endRecord();
+}
+
+void SaveJournal::recordFloor(int floor, uint32_t floorSeed, uint32_t layoutChecksum, float playerX, float playerY) {
+    if (!file) return;
+    ByteWriter writer(beginRecord(JournalEvent::FLOOR));
+    writer.i32(floor);
+    writer.u32(floorSeed);
+    writer.u32(layoutChecksum);
+    writer.f32(playerX);
+    writer.f32(playerY);
+    endRecord();
+}
+
+int SaveJournal::replay(SaveData& data, const std::string& journalFile, const std::string& previousJournalFile) {
+    // Journals are only started after a full run-state snapshot
+    if (!data.hasRunState || data.journalEpoch == 0) return 0;
+
+    int applied = 0;
+    uint32_t epoch;
+    std::string bytes;
+    ReplayState state{std::vector<bool>(data.enemies.size(), false), true};
+
+    // The previous journal matches when the snapshot that closed it never
+    // reached the disk; the current journal then continues from it. Its
+    // kill indices refer to that lost snapshot's list, not to this one.
+    bool previousApplied = false;
+    if (readJournal(previousJournalFile, epoch, bytes) && epoch == data.journalEpoch) {
+        applied += replayRecords(data, state, bytes);
+        previousApplied = true;
+    }
+
+    if (readJournal(journalFile, epoch, bytes) &&
+        (epoch == data.journalEpoch || (previousApplied && epoch == data.journalEpoch + 1))) {
+        state.indicesMatch = !previousApplied;
+        applied += replayRecords(data, state, bytes);
+        data.journalEpoch = epoch;
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < data.enemies.size(); i++) {
+        if (!state.killed[i]) data.enemies[kept++] = data.enemies[i];
+    }
+    data.enemies.resize(kept);
+
+    if (applied > 0) {
+        std::cout << "Replayed " << applied << " events from the save journal" << std::endl;
+    }
+    return applied;
+}
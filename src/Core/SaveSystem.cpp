@@ -1,8 +1,289 @@
 #include "SaveSystem.h"
+#include "ByteStream.h"
+#include "JsonReader.h"
+#include "PerfectHash.h"
+#include "Config.h"
 #include <fstream>
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
+#include <sstream>
 #include <ctime>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <system_error>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// Binary save layout, all integers little-endian:
+//   header   "DC2S" magic, u16 format version, u16 reserved,
+//            u32 payload size, u32 CRC-32 of the payload
+//   payload  sections of {u16 id, u32 length, bytes}. The first one is the
+//            fixed-size SUMMARY, so the load menu can read it from the
+//            first few dozen bytes without touching the rest.
+// Readers skip sections they don't know, and fields are only ever appended
+// to the end of a section, with a missing tail reading as the default. Old
+// builds can open newer saves and new builds can open older ones.
+namespace {
+    constexpr char SAVE_MAGIC[4] = {'D', 'C', '2', 'S'};
+    constexpr uint16_t SAVE_FORMAT_VERSION = 1;
+    constexpr std::size_t HEADER_SIZE = 16;
+
+    enum class SaveSection : uint16_t {
+        PLAYER = 1,
+        PROGRESS = 2,
+        POTIONS = 3,
+        STATISTICS = 4,
+        EXPLORED = 5,
+        RUN = 6,
+        INVENTORY = 7,
+        SPELLS = 8,
+        BUFFS = 9,
+        ENEMIES = 10,
+        COMPANION = 11,
+        SUMMARY = 12  // Always first, see writeSummary
+    };
+
+    // Summary record: 32-byte NUL-padded name, i32 level, i32 floor,
+    // f32 play time, i64 saved-at, u32 CRC-32 of the preceding bytes
+    constexpr std::size_t SUMMARY_NAME_SIZE = 32;
+    constexpr std::size_t SUMMARY_SIZE = 56;
+    constexpr std::size_t SUMMARY_OFFSET = HEADER_SIZE + 6;  // After the section's id and length
+
+    // Slot index: "DC2I" magic, u16 version, u16 count, then per slot a u16
+    // slot number and a summary record
+    constexpr char INDEX_MAGIC[4] = {'D', 'C', '2', 'I'};
+    constexpr uint16_t INDEX_FORMAT_VERSION = 1;
+    constexpr std::size_t INDEX_HEADER_SIZE = 8;
+
+    // The index is written by the save worker and read by the menu
+    std::mutex indexMutex;
+
+    // Top-level keys of the JSON export, dispatched through a perfect hash
+    enum class JsonField : uint8_t {
+        PLAYER_NAME, PLAYER_LEVEL, PLAYER_HEALTH, PLAYER_MAX_HEALTH, PLAYER_EXPERIENCE,
+        SCORE, ENEMIES_KILLED, CURRENT_FLOOR, PLAY_TIME, CURRENT_WEAPON, POTIONS, INVENTORY,
+        TOTAL_DAMAGE_DEALT, TOTAL_DAMAGE_TAKEN, POTIONS_USED, HIGHEST_FLOOR,
+        EXPLORED_FLOOR, EXPLORED_TILES, LAST_SAVE_TIME
+    };
+
+    struct JsonFieldName {
+        std::string_view name;
+        JsonField field;
+    };
+
+    constexpr JsonFieldName jsonFields[] = {
+        {"playerName", JsonField::PLAYER_NAME},
+        {"playerLevel", JsonField::PLAYER_LEVEL},
+        {"playerHealth", JsonField::PLAYER_HEALTH},
+        {"playerMaxHealth", JsonField::PLAYER_MAX_HEALTH},
+        {"playerExperience", JsonField::PLAYER_EXPERIENCE},
+        {"score", JsonField::SCORE},
+        {"enemiesKilled", JsonField::ENEMIES_KILLED},
+        {"currentFloor", JsonField::CURRENT_FLOOR},
+        {"playTime", JsonField::PLAY_TIME},
+        {"currentWeapon", JsonField::CURRENT_WEAPON},
+        {"potions", JsonField::POTIONS},
+        {"inventory", JsonField::INVENTORY},
+        {"totalDamageDealt", JsonField::TOTAL_DAMAGE_DEALT},
+        {"totalDamageTaken", JsonField::TOTAL_DAMAGE_TAKEN},
+        {"potionsUsed", JsonField::POTIONS_USED},
+        {"highestFloor", JsonField::HIGHEST_FLOOR},
+        {"exploredFloor", JsonField::EXPLORED_FLOOR},
+        {"exploredTiles", JsonField::EXPLORED_TILES},
+        {"lastSaveTime", JsonField::LAST_SAVE_TIME},
+    };
+
+    constexpr auto jsonFieldHash = buildPerfectHash<32>(jsonFields, &JsonFieldName::name);
+
+    const JsonFieldName* findJsonField(std::string_view key) {
+        std::uint8_t index = jsonFieldHash.find(key);
+        if (index == PerfectHash<32>::EMPTY || jsonFields[index].name != key) return nullptr;
+        return &jsonFields[index];
+    }
+
+    bool readPotionsJSON(JsonReader& reader, PotionInventory& potions) {
+        if (reader.next() != JsonToken::BEGIN_OBJECT) return false;
+
+        JsonToken token;
+        while ((token = reader.next()) == JsonToken::KEY) {
+            std::string_view key = reader.getText();
+            if (key == "health") reader.readInt(potions.healthPotions);
+            else if (key == "speed") reader.readInt(potions.speedPotions);
+            else if (key == "stealth") reader.readInt(potions.stealthPotions);
+            else if (key == "rage") reader.readInt(potions.ragePotions);
+            else if (key == "mana") reader.readInt(potions.manaPotions);
+            else reader.skipValue();
+        }
+        return token == JsonToken::END_OBJECT;
+    }
+
+    bool readInventoryJSON(JsonReader& reader, std::vector<SavedItem>& inventory) {
+        if (reader.next() != JsonToken::BEGIN_ARRAY) return false;
+        inventory.clear();
+
+        JsonToken token;
+        while ((token = reader.next()) == JsonToken::BEGIN_OBJECT) {
+            SavedItem item;
+            while ((token = reader.next()) == JsonToken::KEY) {
+                std::string_view key = reader.getText();
+                if (key == "name") reader.readString(item.name);
+                else if (key == "quantity") reader.readInt(item.quantity);
+                else reader.skipValue();
+            }
+            if (token != JsonToken::END_OBJECT) return false;
+            inventory.push_back(std::move(item));
+        }
+        return token == JsonToken::END_ARRAY;
+    }
+
+    void writeSummary(std::string& out, const SaveSummary& summary) {
+        std::size_t start = out.size();
+        std::size_t nameLength = std::min(summary.playerName.size(), SUMMARY_NAME_SIZE);
+        out.append(summary.playerName, 0, nameLength);
+        out.append(SUMMARY_NAME_SIZE - nameLength, '\0');
+
+        ByteWriter writer(out);
+        writer.i32(summary.level);
+        writer.i32(summary.floor);
+        writer.f32(summary.playTime);
+        writer.u32((uint32_t)summary.savedAt);
+        writer.u32((uint32_t)((uint64_t)summary.savedAt >> 32));
+        writer.u32(crc32(out.data() + start, SUMMARY_SIZE - 4));
+    }
+
+    bool readSummaryRecord(const char* data, SaveSummary& summary) {
+        ByteReader reader(data + SUMMARY_NAME_SIZE, SUMMARY_SIZE - SUMMARY_NAME_SIZE);
+        uint32_t savedLow, savedHigh, checksum;
+        reader.i32(summary.level);
+        reader.i32(summary.floor);
+        reader.f32(summary.playTime);
+        reader.u32(savedLow);
+        reader.u32(savedHigh);
+        reader.u32(checksum);
+        if (crc32(data, SUMMARY_SIZE - 4) != checksum) return false;
+
+        const char* nameEnd = (const char*)std::memchr(data, '\0', SUMMARY_NAME_SIZE);
+        summary.playerName.assign(data, nameEnd ? (std::size_t)(nameEnd - data) : SUMMARY_NAME_SIZE);
+        summary.savedAt = (int64_t)(((uint64_t)savedHigh << 32) | savedLow);
+        return true;
+    }
+
+    SaveSummary summarize(const SaveData& data) {
+        SaveSummary summary;
+        summary.playerName = data.playerName;
+        summary.level = data.playerLevel;
+        summary.floor = data.currentFloor;
+        summary.playTime = data.playTime;
+        summary.savedAt = (int64_t)std::time(nullptr);
+        return summary;
+    }
+
+    bool syncToDisk(std::FILE* file) {
+#ifdef _WIN32
+        return _commit(_fileno(file)) == 0;
+#else
+        return fsync(fileno(file)) == 0;
+#endif
+    }
+
+    void appendJSONString(std::ostringstream& out, const std::string& value) {
+        out << '"';
+        for (char c : value) {
+            switch (c) {
+                case '"': out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\r': out << "\\r"; break;
+                case '\t': out << "\\t"; break;
+                default:
+                    if ((unsigned char)c < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned char)c);
+                        out << escaped;
+                    } else {
+                        out << c;
+                    }
+            }
+        }
+        out << '"';
+    }
+
+    // The temp file is flushed to disk and only then renamed over the target,
+    // so a crash mid-write leaves the old file intact. std::filesystem::rename
+    // replaces an existing target (MoveFileEx with REPLACE_EXISTING on Windows).
+    bool writeFileAtomic(const std::string& filename, const std::string& bytes) {
+        std::error_code error;
+        std::filesystem::path target(filename);
+        if (target.has_parent_path()) {
+            std::filesystem::create_directories(target.parent_path(), error);
+        }
+
+        std::string tempFilename = filename + ".tmp";
+        std::FILE* file = std::fopen(tempFilename.c_str(), "wb");
+        if (!file) {
+            std::cerr << "Failed to open save file: " << tempFilename << std::endl;
+            return false;
+        }
+
+        bool written = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size() &&
+                       std::fflush(file) == 0 &&
+                       syncToDisk(file);
+        written = std::fclose(file) == 0 && written;
+
+        if (!written) {
+            std::cerr << "Failed to write save file: " << tempFilename << std::endl;
+            std::filesystem::remove(tempFilename, error);
+            return false;
+        }
+
+        std::filesystem::rename(tempFilename, target, error);
+        if (error) {
+            std::cerr << "Failed to replace " << filename << ": " << error.message() << std::endl;
+            std::filesystem::remove(tempFilename, error);
+            return false;
+        }
+        return true;
+    }
+
+    // Reads a save file and checks its header and checksum
+    bool readSaveFile(const std::string& filename, std::string& payload) {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return false;
+
+        std::string bytes((std::size_t)file.tellg(), '\0');
+        file.seekg(0);
+        file.read(&bytes[0], (std::streamsize)bytes.size());
+        if (bytes.size() < HEADER_SIZE || std::memcmp(bytes.data(), SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0) {
+            std::cerr << "Not a save file: " << filename << std::endl;
+            return false;
+        }
+
+        ByteReader header(bytes.data() + sizeof(SAVE_MAGIC), HEADER_SIZE - sizeof(SAVE_MAGIC));
+        uint16_t version, reserved;
+        uint32_t payloadSize, checksum;
+        header.u16(version);
+        header.u16(reserved);
+        header.u32(payloadSize);
+        header.u32(checksum);
+
+        if (payloadSize != bytes.size() - HEADER_SIZE ||
+            crc32(bytes.data() + HEADER_SIZE, payloadSize) != checksum) {
+            std::cerr << "Save file is corrupt: " << filename << std::endl;
+            return false;
+        }
+
+        payload.assign(bytes, HEADER_SIZE, payloadSize);
+        return true;
+    }
+}
 
 std::string SaveSystem::getCurrentTimestamp() {
     auto now = std::chrono::system_clock::now();
@@ -15,14 +296,240 @@ std::string SaveSystem::getCurrentTimestamp() {
     return timeStr;
 }
 
-void SaveData::toJSON(const std::string& filename) const{
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open save file: " << filename << std::endl;
-        return;
+void SaveData::writeBinary(std::string& out) const {
+    ByteWriter writer(out);
+
+    writer.beginSection(SaveSection::PLAYER);
+    writer.str(playerName);
+    writer.i32(playerLevel);
+    writer.i32(playerHealth);
+    writer.i32(playerMaxHealth);
+    writer.i32(playerExperience);
+    writer.str(currentWeapon);
+    writer.endSection();
+
+    writer.beginSection(SaveSection::PROGRESS);
+    writer.i32(score);
+    writer.i32(enemiesKilled);
+    writer.i32(currentFloor);
+    writer.f32(playTime);
+    writer.str(lastSaveTime);
+    writer.endSection();
+
+    writer.beginSection(SaveSection::POTIONS);
+    writer.i32(potions.healthPotions);
+    writer.i32(potions.speedPotions);
+    writer.i32(potions.stealthPotions);
+    writer.i32(potions.ragePotions);
+    writer.i32(potions.manaPotions);
+    writer.endSection();
+
+    writer.beginSection(SaveSection::STATISTICS);
+    writer.i32(totalDamageDealt);
+    writer.i32(totalDamageTaken);
+    writer.i32(potionsUsed);
+    writer.i32(highestFloor);
+    writer.endSection();
+
+    writer.beginSection(SaveSection::EXPLORED);
+    writer.i32(exploredFloor);
+    writer.str(exploredTiles);
+    writer.endSection();
+
+    if (!hasRunState) return;
+
+    writer.beginSection(SaveSection::RUN);
+    writer.u32(runSeed);
+    writer.u32(floorSeed);
+    writer.u32(layoutChecksum);
+    writer.f32(playerX);
+    writer.f32(playerY);
+    writer.u32(journalEpoch);
+    writer.endSection();
+
+    // Lists are a count followed by one block per record, so records can
+    // grow new trailing fields the same way sections do
+    writer.beginSection(SaveSection::INVENTORY);
+    writer.u32((uint32_t)inventory.size());
+    for (const auto& item : inventory) {
+        std::size_t record = writer.beginBlock();
+        writer.str(item.name);
+        writer.i32(item.quantity);
+        writer.endBlock(record);
+    }
+    writer.u32((uint32_t)equippedItems.size());
+    for (int item : equippedItems) {
+        writer.i32(item);
+    }
+    writer.endSection();
+
+    writer.beginSection(SaveSection::SPELLS);
+    writer.u32((uint32_t)spells.size());
+    for (const auto& spell : spells) {
+        std::size_t record = writer.beginBlock();
+        writer.i32(spell.type);
+        writer.f32(spell.sinceCast);
+        writer.endBlock(record);
+    }
+    writer.endSection();
+
+    writer.beginSection(SaveSection::BUFFS);
+    writer.f32(speedBuffTime);
+    writer.f32(stealthBuffTime);
+    writer.f32(rageBuffTime);
+    writer.endSection();
+
+    writer.beginSection(SaveSection::ENEMIES);
+    writer.u32((uint32_t)enemies.size());
+    for (const auto& enemy : enemies) {
+        std::size_t record = writer.beginBlock();
+        writer.i32(enemy.type);
+        writer.i32(enemy.level);
+        writer.i32(enemy.health);
+        writer.f32(enemy.x);
+        writer.f32(enemy.y);
+        writer.endBlock(record);
+    }
+    writer.endSection();
+
+    writer.beginSection(SaveSection::COMPANION);
+    writer.i32(companion.type);
+    writer.i32(companion.level);
+    writer.i32(companion.health);
+    writer.f32(companion.x);
+    writer.f32(companion.y);
+    writer.endSection();
+}
+
+bool SaveData::readBinary(const char* data, std::size_t size) {
+    ByteReader reader(data, size);
+
+    while (reader.remaining() > 0) {
+        uint16_t id;
+        uint32_t length;
+        if (!reader.u16(id) || !reader.u32(length) || length > reader.remaining()) {
+            return false;
+        }
+
+        ByteReader section(reader.current(), length);
+        switch ((SaveSection)id) {
+            case SaveSection::PLAYER:
+                section.str(playerName);
+                section.i32(playerLevel);
+                section.i32(playerHealth);
+                section.i32(playerMaxHealth);
+                section.i32(playerExperience);
+                section.str(currentWeapon);
+                break;
+            case SaveSection::PROGRESS:
+                section.i32(score);
+                section.i32(enemiesKilled);
+                section.i32(currentFloor);
+                section.f32(playTime);
+                section.str(lastSaveTime);
+                break;
+            case SaveSection::POTIONS:
+                section.i32(potions.healthPotions);
+                section.i32(potions.speedPotions);
+                section.i32(potions.stealthPotions);
+                section.i32(potions.ragePotions);
+                section.i32(potions.manaPotions);
+                break;
+            case SaveSection::STATISTICS:
+                section.i32(totalDamageDealt);
+                section.i32(totalDamageTaken);
+                section.i32(potionsUsed);
+                section.i32(highestFloor);
+                break;
+            case SaveSection::EXPLORED:
+                section.i32(exploredFloor);
+                section.str(exploredTiles);
+                break;
+            case SaveSection::RUN:
+                hasRunState = true;
+                section.u32(runSeed);
+                section.u32(floorSeed);
+                section.u32(layoutChecksum);
+                section.f32(playerX);
+                section.f32(playerY);
+                section.u32(journalEpoch);
+                break;
+            case SaveSection::INVENTORY: {
+                uint32_t count = 0;
+                section.u32(count);
+                inventory.clear();
+                ByteReader record(nullptr, 0);
+                for (uint32_t i = 0; i < count && section.block(record); i++) {
+                    SavedItem item;
+                    record.str(item.name);
+                    record.i32(item.quantity);
+                    inventory.push_back(std::move(item));
+                }
+                count = 0;
+                section.u32(count);
+                equippedItems.clear();
+                int item;
+                for (uint32_t i = 0; i < count && section.i32(item); i++) {
+                    equippedItems.push_back(item);
+                }
+                break;
+            }
+            case SaveSection::SPELLS: {
+                uint32_t count = 0;
+                section.u32(count);
+                spells.clear();
+                ByteReader record(nullptr, 0);
+                for (uint32_t i = 0; i < count && section.block(record); i++) {
+                    SavedSpell spell;
+                    record.i32(spell.type);
+                    record.f32(spell.sinceCast);
+                    spells.push_back(spell);
+                }
+                break;
+            }
+            case SaveSection::BUFFS:
+                section.f32(speedBuffTime);
+                section.f32(stealthBuffTime);
+                section.f32(rageBuffTime);
+                break;
+            case SaveSection::ENEMIES: {
+                uint32_t count = 0;
+                section.u32(count);
+                enemies.clear();
+                ByteReader record(nullptr, 0);
+                for (uint32_t i = 0; i < count && section.block(record); i++) {
+                    SavedEnemy enemy;
+                    record.i32(enemy.type);
+                    record.i32(enemy.level);
+                    record.i32(enemy.health);
+                    record.f32(enemy.x);
+                    record.f32(enemy.y);
+                    enemies.push_back(enemy);
+                }
+                break;
+            }
+            case SaveSection::COMPANION:
+                section.i32(companion.type);
+                section.i32(companion.level);
+                section.i32(companion.health);
+                section.f32(companion.x);
+                section.f32(companion.y);
+                break;
+            default:
+                break; // Written by a newer version
+        }
+
+        reader.skip(length);
     }
 
+    return true;
+}
+
+std::string SaveData::toJSON() const {
+    std::ostringstream file;
+
     file << "{\n";
+    file << "  \"playerName\": "; appendJSONString(file, playerName); file << ",\n";
     file << "  \"playerLevel\": " << playerLevel << ",\n";
     file << "  \"playerHealth\": " << playerHealth << ",\n";
     file << "  \"playerMaxHealth\": " << playerMaxHealth << ",\n";
@@ -31,7 +538,7 @@ void SaveData::toJSON(const std::string& filename) const{
     file << "  \"enemiesKilled\": " << enemiesKilled << ",\n";
     file << "  \"currentFloor\": " << currentFloor << ",\n";
     file << "  \"playTime\": " << playTime << ",\n";
-    file << "  \"currentWeapon\": \"" << currentWeapon << "\",\n";
+    file << "  \"currentWeapon\": "; appendJSONString(file, currentWeapon); file << ",\n";
     file << "  \"potions\": {\n";
     file << "    \"health\": " << potions.healthPotions << ",\n";
     file << "    \"speed\": " << potions.speedPotions << ",\n";
@@ -39,75 +546,322 @@ void SaveData::toJSON(const std::string& filename) const{
     file << "    \"rage\": " << potions.ragePotions << ",\n";
     file << "    \"mana\": " << potions.manaPotions << "\n";
     file << "  },\n";
+    file << "  \"inventory\": [";
+    for (std::size_t i = 0; i < inventory.size(); i++) {
+        file << (i == 0 ? "\n" : ",\n") << "    {\"name\": ";
+        appendJSONString(file, inventory[i].name);
+        file << ", \"quantity\": " << inventory[i].quantity << "}";
+    }
+    file << (inventory.empty() ? "],\n" : "\n  ],\n");
     file << "  \"totalDamageDealt\": " << totalDamageDealt << ",\n";
     file << "  \"totalDamageTaken\": " << totalDamageTaken << ",\n";
     file << "  \"potionsUsed\": " << potionsUsed << ",\n";
     file << "  \"highestFloor\": " << highestFloor << ",\n";
-    file << "  \"lastSaveTime\": \"" << lastSaveTime << "\"\n";
+    file << "  \"exploredFloor\": " << exploredFloor << ",\n";
+    file << "  \"exploredTiles\": "; appendJSONString(file, exploredTiles); file << ",\n";
+    file << "  \"lastSaveTime\": "; appendJSONString(file, lastSaveTime); file << "\n";
     file << "}\n";
 
-    file.close();
-    std::cout << "Game saved to " << filename << std::endl;
+    return file.str();
 }
 
 bool SaveData::fromJSON(const std::string& filename) {
-    std::ifstream file(filename);
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
         return false;
     }
 
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.find("playerLevel") != std::string::npos) {
-            sscanf(line.c_str(), "  \"playerLevel\": %d,", &playerLevel);
-        } else if (line.find("playerHealth") != std::string::npos && line.find("Max") == std::string::npos) {
-            sscanf(line.c_str(), "  \"playerHealth\": %d,", &playerHealth);
-        } else if (line.find("playerMaxHealth") != std::string::npos) {
-            sscanf(line.c_str(), "  \"playerMaxHealth\": %d,", &playerMaxHealth);
-        } else if (line.find("playerExperience") != std::string::npos) {
-            sscanf(line.c_str(), "  \"playerExperience\": %d,", &playerExperience);
-        } else if (line.find("score") != std::string::npos && line.find("playTime") == std::string::npos) {
-            sscanf(line.c_str(), "  \"score\": %d,", &score);
-        } else if (line.find("enemiesKilled") != std::string::npos) {
-            sscanf(line.c_str(), "  \"enemiesKilled\": %d,", &enemiesKilled);
-        } else if (line.find("currentFloor") != std::string::npos) {
-            sscanf(line.c_str(), "  \"currentFloor\": %d,", &currentFloor);
-        } else if (line.find("playTime") != std::string::npos) {
-            sscanf(line.c_str(), "  \"playTime\": %f,", &playTime);
-        } else if (line.find("\"health\"") != std::string::npos) {
-            sscanf(line.c_str(), "    \"health\": %d,", &potions.healthPotions);
-        } else if (line.find("\"speed\"") != std::string::npos) {
-            sscanf(line.c_str(), "    \"speed\": %d,", &potions.speedPotions);
-        } else if (line.find("\"stealth\"") != std::string::npos) {
-            sscanf(line.c_str(), "    \"stealth\": %d,", &potions.stealthPotions);
-        } else if (line.find("\"rage\"") != std::string::npos) {
-            sscanf(line.c_str(), "    \"rage\": %d,", &potions.ragePotions);
-        } else if (line.find("\"mana\"") != std::string::npos) {
-            sscanf(line.c_str(), "    \"mana\": %d", &potions.manaPotions);
-        } else if (line.find("totalDamageDealt") != std::string::npos) {
-            sscanf(line.c_str(), "  \"totalDamageDealt\": %d,", &totalDamageDealt);
-        } else if (line.find("totalDamageTaken") != std::string::npos) {
-            sscanf(line.c_str(), "  \"totalDamageTaken\": %d,", &totalDamageTaken);
-        } else if (line.find("highestFloor") != std::string::npos) {
-            sscanf(line.c_str(), "  \"highestFloor\": %d,", &highestFloor);
-        }
-    }
-
-    file.close();
+    std::string bytes((std::size_t)file.tellg(), '\0');
+    file.seekg(0);
+    file.read(&bytes[0], (std::streamsize)bytes.size());
+
+    std::string error;
+    if (!parseJSON(bytes.data(), bytes.size(), &error)) {
+        std::cerr << filename << ":" << error << std::endl;
+        return false;
+    }
+
     std::cout << "Game loaded from " << filename << std::endl;
     return true;
 }
 
-bool SaveSystem::save(const SaveData& data, const std::string& filename) {
-    const_cast<SaveData&>(data).toJSON(filename);
+bool SaveData::parseJSON(const char* data, std::size_t size, std::string* error) {
+    JsonReader reader(data, size);
+    bool parsed = reader.next() == JsonToken::BEGIN_OBJECT;
+
+    JsonToken token = JsonToken::ERROR;
+    while (parsed && (token = reader.next()) == JsonToken::KEY) {
+        const JsonFieldName* field = findJsonField(reader.getText());
+        if (!field) {
+            parsed = reader.skipValue();  // Newer or dashboard-only keys
+            continue;
+        }
+
+        // A value of the wrong type is skipped and the field keeps its default
+        switch (field->field) {
+            case JsonField::PLAYER_NAME: reader.readString(playerName); break;
+            case JsonField::PLAYER_LEVEL: reader.readInt(playerLevel); break;
+            case JsonField::PLAYER_HEALTH: reader.readInt(playerHealth); break;
+            case JsonField::PLAYER_MAX_HEALTH: reader.readInt(playerMaxHealth); break;
+            case JsonField::PLAYER_EXPERIENCE: reader.readInt(playerExperience); break;
+            case JsonField::SCORE: reader.readInt(score); break;
+            case JsonField::ENEMIES_KILLED: reader.readInt(enemiesKilled); break;
+            case JsonField::CURRENT_FLOOR: reader.readInt(currentFloor); break;
+            case JsonField::PLAY_TIME: reader.readFloat(playTime); break;
+            case JsonField::CURRENT_WEAPON: reader.readString(currentWeapon); break;
+            case JsonField::POTIONS: parsed = readPotionsJSON(reader, potions); break;
+            case JsonField::INVENTORY: parsed = readInventoryJSON(reader, inventory); break;
+            case JsonField::TOTAL_DAMAGE_DEALT: reader.readInt(totalDamageDealt); break;
+            case JsonField::TOTAL_DAMAGE_TAKEN: reader.readInt(totalDamageTaken); break;
+            case JsonField::POTIONS_USED: reader.readInt(potionsUsed); break;
+            case JsonField::HIGHEST_FLOOR: reader.readInt(highestFloor); break;
+            case JsonField::EXPLORED_FLOOR: reader.readInt(exploredFloor); break;
+            case JsonField::EXPLORED_TILES: reader.readString(exploredTiles); break;
+            case JsonField::LAST_SAVE_TIME: reader.readString(lastSaveTime); break;
+        }
+        parsed = parsed && !reader.getError();
+    }
+
+    parsed = parsed && token == JsonToken::END_OBJECT && reader.next() == JsonToken::END;
+    if (!parsed && error) {
+        *error = std::to_string(reader.getLine()) + ": " +
+                 (reader.getError() ? reader.getError() : "unexpected JSON structure");
+    }
+    return parsed;
+}
+
+bool SaveSystem::save(const SaveData& data, const std::string& filename, const std::string& backupFilename) {
+    std::string bytes(SAVE_MAGIC, sizeof(SAVE_MAGIC));
+    ByteWriter writer(bytes);
+    writer.u16(SAVE_FORMAT_VERSION);
+    writer.u16(0);
+    writer.u32(0);  // Payload size, patched below
+    writer.u32(0);  // Checksum, patched below
+
+    writer.beginSection(SaveSection::SUMMARY);
+    writeSummary(bytes, summarize(data));
+    writer.endSection();
+
+    data.writeBinary(bytes);
+
+    std::size_t payloadSize = bytes.size() - HEADER_SIZE;
+    writer.patchU32(8, (uint32_t)payloadSize);
+    writer.patchU32(12, crc32(bytes.data() + HEADER_SIZE, payloadSize));
+
+    // Rotate the current save into the backup slot, but never overwrite a
+    // good backup with a file that is already damaged. If the write below
+    // fails, load() still finds the backup.
+    std::string existing;
+    if (readSaveFile(filename, existing)) {
+        std::error_code error;
+        std::filesystem::rename(filename, backupFilename, error);
+        if (error) {
+            std::cerr << "Failed to rotate backup save: " << error.message() << std::endl;
+        }
+    }
+
+    if (!writeFileAtomic(filename, bytes)) {
+        return false;
+    }
+
+    std::cout << "Game saved to " << filename << " (" << bytes.size() << " bytes)" << std::endl;
     return true;
 }
 
-bool SaveSystem::load(SaveData& data, const std::string& filename) {
-    return data.fromJSON(filename);
+bool SaveSystem::load(SaveData& data, const std::string& filename, const std::string& backupFilename) {
+    for (const std::string* candidate : {&filename, &backupFilename}) {
+        std::string payload;
+        SaveData loaded;
+        if (readSaveFile(*candidate, payload) && loaded.readBinary(payload.data(), payload.size())) {
+            data = std::move(loaded);
+            std::cout << "Game loaded from " << *candidate << std::endl;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SaveSystem::exportJSON(const SaveData& data, const std::string& filename) {
+    return writeFileAtomic(filename, data.toJSON());
 }
 
 bool SaveSystem::saveExists(const std::string& filename) {
-    std::ifstream file(filename);
-    return file.good();
+    std::error_code error;
+    return std::filesystem::exists(filename, error);
+}
+
+bool SaveSystem::deleteSave(const std::string& filename) {
+    std::error_code error;
+    return std::filesystem::remove(filename, error);
+}
+
+namespace {
+    bool readIndex(std::vector<SaveSummary>& entries) {
+        std::ifstream file(Config::SAVE_INDEX_FILE, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return false;
+
+        std::string bytes((std::size_t)file.tellg(), '\0');
+        file.seekg(0);
+        file.read(&bytes[0], (std::streamsize)bytes.size());
+        if (bytes.size() < INDEX_HEADER_SIZE || std::memcmp(bytes.data(), INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0) {
+            return false;
+        }
+
+        ByteReader reader(bytes.data() + sizeof(INDEX_MAGIC), bytes.size() - sizeof(INDEX_MAGIC));
+        uint16_t version, count;
+        reader.u16(version);
+        reader.u16(count);
+        if (version != INDEX_FORMAT_VERSION || reader.remaining() != count * (2 + SUMMARY_SIZE)) return false;
+
+        entries.clear();
+        for (uint16_t i = 0; i < count; i++) {
+            SaveSummary summary;
+            uint16_t slot = 0;
+            reader.u16(slot);
+            if (!readSummaryRecord(reader.current(), summary)) return false;
+            reader.skip(SUMMARY_SIZE);
+            summary.slot = slot;
+            entries.push_back(std::move(summary));
+        }
+        return true;
+    }
+
+    bool writeIndex(const std::vector<SaveSummary>& entries) {
+        std::string bytes(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+        ByteWriter writer(bytes);
+        writer.u16(INDEX_FORMAT_VERSION);
+        writer.u16((uint16_t)entries.size());
+        for (const auto& summary : entries) {
+            writer.u16((uint16_t)summary.slot);
+            writeSummary(bytes, summary);
+        }
+        return writeFileAtomic(Config::SAVE_INDEX_FILE, bytes);
+    }
+
+    // Summary for a slot without an index entry. Saves from before summaries
+    // existed are loaded in full, which only happens while rebuilding.
+    bool scanSlot(int slot, SaveSummary& summary) {
+        SaveSlotFiles files = SaveSystem::getSlotFiles(slot);
+        if (!SaveSystem::readSummary(files.save, summary) && !SaveSystem::readSummary(files.backup, summary)) {
+            SaveData data;
+            if (!SaveSystem::load(data, files.save, files.backup) && !data.fromJSON(files.exportJSON)) {
+                return false;
+            }
+
+            summary = summarize(data);
+            summary.savedAt = 0;  // Unknown until the slot is saved again
+        }
+        summary.slot = slot;
+        return true;
+    }
+
+    std::vector<SaveSummary> rebuildIndex() {
+        std::vector<SaveSummary> entries;
+        for (int slot = 0; slot < Config::MAX_SAVE_SLOTS; slot++) {
+            if (!SaveSystem::slotExists(slot)) continue;
+            SaveSummary summary;
+            if (scanSlot(slot, summary)) entries.push_back(std::move(summary));
+        }
+        writeIndex(entries);
+        return entries;
+    }
+
+    std::vector<SaveSummary> loadIndex() {
+        std::vector<SaveSummary> entries;
+        if (!readIndex(entries)) entries = rebuildIndex();
+        return entries;
+    }
+}
+
+SaveSlotFiles SaveSystem::getSlotFiles(int slot) {
+    std::string stem = Config::SAVE_FILE_STEM;
+    if (slot > 0) stem += "_slot" + std::to_string(slot);
+
+    SaveSlotFiles files;
+    files.save = stem + ".dat";
+    files.backup = stem + "_backup.dat";
+    files.exportJSON = stem + ".json";
+    files.journal = stem + ".journal";
+    files.previousJournal = stem + "_previous.journal";
+    return files;
+}
+
+bool SaveSystem::slotExists(int slot) {
+    SaveSlotFiles files = getSlotFiles(slot);
+    return saveExists(files.save) || saveExists(files.backup) || saveExists(files.exportJSON);
+}
+
+bool SaveSystem::saveSlot(const SaveData& data, int slot) {
+    SaveSlotFiles files = getSlotFiles(slot);
+    if (!save(data, files.save, files.backup)) {
+        return false;
+    }
+    exportJSON(data, files.exportJSON);
+
+    // Re-read the header just written so the index matches it exactly
+    SaveSummary summary;
+    if (!readSummary(files.save, summary)) {
+        return true;
+    }
+    summary.slot = slot;
+
+    std::lock_guard<std::mutex> lock(indexMutex);
+    std::vector<SaveSummary> entries = loadIndex();
+    auto it = std::find_if(entries.begin(), entries.end(),
+                           [slot](const SaveSummary& entry) { return entry.slot == slot; });
+    if (it != entries.end()) {
+        *it = std::move(summary);
+    } else {
+        entries.push_back(std::move(summary));
+    }
+    writeIndex(entries);
+    return true;
+}
+
+bool SaveSystem::deleteSave(int slot) {
+    SaveSlotFiles files = getSlotFiles(slot);
+    bool removed = false;
+    for (const std::string* file : {&files.save, &files.backup, &files.exportJSON, &files.journal, &files.previousJournal}) {
+        removed = deleteSave(*file) || removed;
+    }
+
+    std::lock_guard<std::mutex> lock(indexMutex);
+    std::vector<SaveSummary> entries = loadIndex();
+    auto it = std::remove_if(entries.begin(), entries.end(),
+                             [slot](const SaveSummary& entry) { return entry.slot == slot; });
+    if (it != entries.end()) {
+        entries.erase(it, entries.end());
+        writeIndex(entries);
+    }
+    return removed;
+}
+
+bool SaveSystem::readSummary(const std::string& filename, SaveSummary& summary) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char bytes[SUMMARY_OFFSET + SUMMARY_SIZE];
+    if (!file.read(bytes, sizeof(bytes)) || std::memcmp(bytes, SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0) {
+        return false;
+    }
+
+    ByteReader section(bytes + HEADER_SIZE, SUMMARY_OFFSET - HEADER_SIZE);
+    uint16_t id;
+    uint32_t length;
+    section.u16(id);
+    section.u32(length);
+    if ((SaveSection)id != SaveSection::SUMMARY || length != SUMMARY_SIZE) return false;
+
+    return readSummaryRecord(bytes + SUMMARY_OFFSET, summary);
+}
+
+std::vector<SaveSummary> SaveSystem::getAllSaves() {
+    std::vector<SaveSummary> entries;
+    {
+        std::lock_guard<std::mutex> lock(indexMutex);
+        entries = loadIndex();
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const SaveSummary& a, const SaveSummary& b) { return a.savedAt > b.savedAt; });
+    return entries;
 }
@@ -0,0 +1,73 @@
+#include "SaveWorker.h"
+#include <chrono>
+#include <iostream>
+
+SaveWorker::SaveWorker()
+    : hasPending(false), writing(false), stopping(false),
+      busy(false), lastSaveFailed(false), lastSaveFinishedAt(0) {
+    worker = std::thread(&SaveWorker::run, this);
+}
+
+SaveWorker::~SaveWorker() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    worker.join();  // run() finishes any pending save before it exits
+}
+
+void SaveWorker::request(SaveData snapshot, int slot) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.data = std::move(snapshot);
+        pending.slot = slot;
+        hasPending = true;
+        busy = true;
+    }
+    wake.notify_one();
+}
+
+void SaveWorker::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return !hasPending && !writing; });
+}
+
+float SaveWorker::getSecondsSinceLastSave() const {
+    long long finishedAt = lastSaveFinishedAt;
+    if (finishedAt == 0) return -1.0f;
+
+    auto elapsed = std::chrono::steady_clock::now().time_since_epoch() - std::chrono::steady_clock::duration(finishedAt);
+    return std::chrono::duration<float>(elapsed).count();
+}
+
+void SaveWorker::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        wake.wait(lock, [this] { return hasPending || stopping; });
+        if (!hasPending) break;  // Stopping with nothing left to write
+
+        SaveRequest job = std::move(pending);
+        hasPending = false;
+        writing = true;
+        lock.unlock();
+
+        bool saved = SaveSystem::saveSlot(job.data, job.slot);
+        if (!saved) {
+            std::cout << "Warning: Game could not be saved" << std::endl;
+        }
+
+        lastSaveFailed = !saved;
+        lastSaveFinishedAt = std::chrono::steady_clock::now().time_since_epoch().count();
+
+        lock.lock();
+        writing = false;
+        busy = hasPending;
+        if (!hasPending) idle.notify_all();
+    }
+
+    writing = false;
+    busy = false;
+    idle.notify_all();
+}
@@ -1,5 +1,8 @@
 #include "Enemy.h"
 #include "Config.h"
+#include "TextAtlas.h"
+#include "MapGenerator.h"
+#include "ProjectileSystem.h"
 #include <iostream>
 #include <unordered_map>
 #include <cmath>
@@ -19,7 +22,9 @@ Enemy::Enemy(EnemyType type, int hp, int lvl, const std::string& spritePath,
     : Character(hp, lvl, spritePath, name), enemyType(type), tier(EnemyTier::D),
       speed(spd), attackDamage(atk), attackCooldown(2.5f), lastAttackTime(0),
       aggroRange(aggro), attackRange(atkRange), target(nullptr),
-      currentState(AIState::IDLE), hitFlashTime(0) {
+      currentState(AIState::IDLE), inPlayerView(false), hiddenAiTimer(0),
+      map(nullptr), losFromTile(-1), losToTile(-1), losMapGeneration(0), losClear(true), projectiles(nullptr), hitFlashTime(0),
+      nameLabelId(TextAtlas::registerLabel(name, 10)), snapshotIndex(-1) {
 
     // Assign colors based on enemy type
     switch (type) {
@@ -77,7 +82,21 @@ void Enemy::update(float deltaTime) {
     lastAttackTime += deltaTime;
     hitFlashTime = std::max(0.0f, hitFlashTime - deltaTime);
 
-    updateAI(deltaTime);
+    if (inPlayerView) {
+        hiddenAiTimer = 0;
+        updateAI(deltaTime);
+        return;
+    }
+
+    // Out of sight: idle enemies can't notice the player, and the rest
+    // run their AI at a reduced rate with the accumulated time
+    if (currentState == AIState::IDLE) return;
+
+    hiddenAiTimer += deltaTime;
+    if (hiddenAiTimer >= Config::HIDDEN_ENEMY_AI_INTERVAL) {
+        updateAI(hiddenAiTimer);
+        hiddenAiTimer = 0;
+    }
 }
 
 void Enemy::draw() {
@@ -100,7 +119,11 @@ void Enemy::draw() {
     DrawRectangle((int)position.x, (int)position.y - 10, (int)(32 * healthPercent), 3, RED);
 
     // Name
-    DrawText(name.c_str(), (int)position.x - 10, (int)position.y - 25, 10, WHITE);
+    if (nameLabelId >= 0) {
+        TextAtlas::drawLabel(nameLabelId, {(float)((int)position.x - 10), (float)((int)position.y - 25)}, WHITE);
+    } else {
+        DrawText(name.c_str(), (int)position.x - 10, (int)position.y - 25, 10, WHITE);
+    }
 }
 
 void Enemy::updateAI(float deltaTime) {
@@ -116,7 +139,7 @@ void Enemy::updateAI(float deltaTime) {
             break;
 
         case AIState::CHASING:
-            if (distanceToTarget <= attackRange && canAttack()) {
+            if (distanceToTarget <= attackRange && canAttack() && hasLineOfSightToTarget()) {
                 currentState = AIState::ATTACKING;
                 performAttack();
             } else if (distanceToTarget > aggroRange * 1.5f) {
@@ -127,7 +150,7 @@ void Enemy::updateAI(float deltaTime) {
             break;
 
         case AIState::ATTACKING:
-            if (distanceToTarget > attackRange) {
+            if (distanceToTarget > attackRange || !hasLineOfSightToTarget()) {
                 currentState = AIState::CHASING;
             } else if (canAttack()) {
                 performAttack();
@@ -160,6 +183,35 @@ void Enemy::performAttack() {
     }
 }
 
+bool Enemy::hasLineOfSightToTarget() {
+    if (!map || !target) return true;
+
+    Vector2 from = {position.x + 16, position.y + 16};
+    Vector2 to = {target->getPosition().x + 16, target->getPosition().y + 16};
+
+    int tileSize = map->getTileSize();
+    int fromTile = (int)(from.y / tileSize) * map->getMapWidth() + (int)(from.x / tileSize);
+    int toTile = (int)(to.y / tileSize) * map->getMapWidth() + (int)(to.x / tileSize);
+
+    if (fromTile != losFromTile || toTile != losToTile || map->getGeneration() != losMapGeneration) {
+        losClear = map->hasLineOfSight(from, to);
+        losFromTile = fromTile;
+        losToTile = toTile;
+        losMapGeneration = map->getGeneration();
+    }
+
+    return losClear;
+}
+
+bool Enemy::fireAtTarget(int damage, float speed, float radius, Color color) {
+    if (!projectiles || !target) return false;
+
+    // Aim at where the target is now; a moving player can sidestep the shot
+    Vector2 from = {position.x + 16, position.y + 16};
+    Vector2 to = {target->getPosition().x + 16, target->getPosition().y + 16};
+    return projectiles->fire(from, to, speed, damage, radius, color, ProjectileOwner::ENEMY);
+}
+
 bool Enemy::canAttack() const {
     return lastAttackTime >= attackCooldown;
 }
@@ -479,12 +531,14 @@ void Elf_Girl::updateAI(float deltaTime) {
 }
 
 void Elf_Girl::performAttack() {
-    if (lastAttackTime < attackCooldown) return;
+    if (lastAttackTime < attackCooldown || !hasLineOfSightToTarget()) return;
     lastAttackTime = 0;
 
     if (target && target->getIsAlive()) {
         int damage = attackDamage;
-        target->takeDamage(damage);
+        if (!fireAtTarget(damage, 360.0f, 3.0f, Color{200, 255, 150, 255})) {
+            target->takeDamage(damage);
+        }
     }
 }
 
@@ -553,13 +607,15 @@ void Mage::updateAI(float deltaTime) {
 }
 
 void Mage::performAttack() {
-    if (lastAttackTime < attackCooldown) return;
+    if (lastAttackTime < attackCooldown || !hasLineOfSightToTarget()) return;
     lastAttackTime = 0;
 
     if (target && target->getIsAlive()) {
         // Higher burst damage
         int damage = attackDamage + 5;
-        target->takeDamage(damage);
+        if (!fireAtTarget(damage, 280.0f, 6.0f, Color{180, 80, 255, 255})) {
+            target->takeDamage(damage);
+        }
     }
 }
 
@@ -799,6 +855,12 @@ void Witch::updateAI(float deltaTime) {
     Enemy::updateAI(deltaTime);
 }
 
+void Witch::performAttack() {
+    // Casts from range, so needs a clear line to the target
+    if (!hasLineOfSightToTarget()) return;
+    Enemy::performAttack();
+}
+
 // Tier S
 
 Necromancer::Necromancer(int playerLevel)
@@ -815,11 +877,13 @@ void Necromancer::updateAI(float deltaTime) {
 }
 
 void Necromancer::performAttack() {
-    if (lastAttackTime < attackCooldown) return;
+    if (lastAttackTime < attackCooldown || !hasLineOfSightToTarget()) return;
     lastAttackTime = 0;
 
     if (target && target->getIsAlive()) {
-        target->takeDamage(attackDamage);
+        if (!fireAtTarget(attackDamage, 220.0f, 7.0f, Color{80, 220, 120, 255})) {
+            target->takeDamage(attackDamage);
+        }
     }
 }
 
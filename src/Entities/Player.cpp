@@ -4,12 +4,34 @@
 #include <iostream>
 #include <algorithm>
 
+namespace {
+    // Spells granted on reaching a level, in unlock order
+    struct SpellUnlock {
+        int level;
+        SpellType type;
+        float cooldown;
+        const char* name;
+    };
+
+    constexpr SpellUnlock spellUnlocks[] = {
+        {5, SpellType::FIREBALL, 2.0f, "Firebolt"},
+        {10, SpellType::CHAIN_LIGHTNING, 6.0f, "Chain Lightning"},
+        {15, SpellType::FROST_NOVA, 8.0f, "Frost Nova"},
+        {20, SpellType::WHIRLWIND, 10.0f, "Whirlwind"},
+    };
+
+    Spell makeSpell(const SpellUnlock& unlock) {
+        // Starts off cooldown
+        return Spell{unlock.type, unlock.cooldown, unlock.cooldown, 0, unlock.name};
+    }
+}
+
 Player::Player()
     : Character(Config::PLAYER_BASE_HEALTH, 1, "assets/sprite/player_small.png", "Hero"),
       speed(Config::PLAYER_BASE_SPEED), attackDamage(Config::PLAYER_BASE_DAMAGE),
       attackCooldown(Config::PLAYER_ATTACK_COOLDOWN), lastAttackTime(0),
       critChance(Config::PLAYER_CRIT_CHANCE), critMultiplier(Config::PLAYER_CRIT_MULTIPLIER),
-      speedMultiplier(1.0f), maxInventorySize(24), speedBuffTime(0), stealthBuffTime(0),
+      speedMultiplier(1.0f), inventoryVersion(0), maxInventorySize(24), speedBuffTime(0), stealthBuffTime(0),
       rageBuffTime(0), isStealthed(false) {
 
     position = {Config::SCREEN_WIDTH / 2.0f, Config::SCREEN_HEIGHT / 2.0f};
@@ -148,62 +170,90 @@ void Player::gainExperience(int amount) {
         attackDamage += Config::DAMAGE_PER_LEVEL;
         speed += Config::SPEED_PER_LEVEL;
 
-        // Unlock items at certain levels
-        if (level == 5) {
-            spells.push_back({SpellType::FIREBALL, 2.0f, 2.0f, 0, "Firebolt"});
-            std::cout << "Spell Unlocked: Firebolt!" << std::endl;
+        for (const auto& unlock : spellUnlocks) {
+            if (unlock.level == level) {
+                spells.push_back(makeSpell(unlock));
+                std::cout << "Spell Unlocked: " << unlock.name << "!" << std::endl;
+            }
         }
-        else if (level == 10) {
-            spells.push_back({SpellType::CHAIN_LIGHTNING, 6.0f, 6.0f, 0, "Chain Lightning"});
+
+        // Unlock items at certain levels
+        if (level == 10) {
             addItem("Scorching Gauntlet", 1);
             addItem("Seeds of Evolution", 5);
             std::cout << "Weapon Unlocked: Scorching Gauntlet!" << std::endl;
         }
-        else if (level == 15) {
-            spells.push_back({SpellType::FROST_NOVA, 8.0f, 8.0f, 0, "Frost Nova"});
-        }
-        else if (level == 20) {
-            spells.push_back({SpellType::WHIRLWIND, 10.0f, 10.0f, 0, "Whirlwind"});
-        }
 
         std::cout << "Level Up! Now level " << level << std::endl;
     }
 }
 
-void Player::addItem(const std::string& itemName, int quantity) {
+void Player::restoreProgress(int lvl, int exp) {
+    // Rebuild everything gainExperience accumulates, without the one-off item rewards
+    level = std::max(1, lvl);
+    experience = exp;
+    maxHealth = Config::PLAYER_BASE_HEALTH + (level - 1) * Config::HEALTH_PER_LEVEL;
+    attackDamage = Config::PLAYER_BASE_DAMAGE + (level - 1) * Config::DAMAGE_PER_LEVEL;
+    speed = Config::PLAYER_BASE_SPEED + (level - 1) * Config::SPEED_PER_LEVEL;
+    health = std::min(health, maxHealth);
+
+    spells.clear();
+    for (const auto& unlock : spellUnlocks) {
+        if (unlock.level <= level) {
+            spells.push_back(makeSpell(unlock));
+        }
+    }
+}
+
+void Player::setSpellCooldownElapsed(SpellType type, float elapsed) {
+    for (auto& spell : spells) {
+        if (spell.type == type) {
+            spell.lastCastTime = elapsed;
+        }
+    }
+}
+
+void Player::setInventory(std::vector<InventoryItem> items) {
+    inventory = std::move(items);
+    inventoryVersion++;
+}
+
+void Player::addItem(std::string_view itemName, int quantity) {
     for (auto& item : inventory) {
         if (item.name == itemName) {
             item.quantity += quantity;
+            inventoryVersion++;
             return;
         }
     }
 
     if (inventory.size() < maxInventorySize) {
-        inventory.push_back({itemName, quantity});
+        inventory.push_back({std::string(itemName), quantity});
+        inventoryVersion++;
     }
 }
 
-bool Player::useItem(const std::string& itemName) {
+bool Player::useItem(std::string_view itemName) {
     for (auto& item : inventory) {
         if (item.name == itemName && item.quantity > 0) {
             item.quantity--;
-
-            if (itemName == "Health Potion") {
-                heal(Config::HEALTH_POTION_HEAL);
-            } else if (itemName == "Speed Potion") {
-                applySpeedBuff(Config::SPEED_POTION_DURATION);
-            } else if (itemName == "Stealth Potion") {
-                applyStealthBuff(Config::STEALTH_POTION_DURATION);
-            } else if (itemName == "Rage Potion") {
-                applyRageBuff(Config::RAGE_POTION_DURATION);
-            } else if (itemName == "Holy Water of Life") {
-                heal(Config::HOLY_WATER_OF_LIFE_HEAL);
+            inventoryVersion++;
+
+            if (const Item* data = ItemSystem::findItemByName(itemName)) {
+                switch (data->type) {
+                    case ItemType::HEALTH_POTION: heal(Config::HEALTH_POTION_HEAL); break;
+                    case ItemType::SPEED_POTION: applySpeedBuff(Config::SPEED_POTION_DURATION); break;
+                    case ItemType::STEALTH_POTION: applyStealthBuff(Config::STEALTH_POTION_DURATION); break;
+                    case ItemType::RAGE_POTION: applyRageBuff(Config::RAGE_POTION_DURATION); break;
+                    case ItemType::HOLY_WATER_OF_LIFE: heal(Config::HOLY_WATER_OF_LIFE_HEAL); break;
+                    default: break;
+                }
             }
 
             if (item.quantity <= 0) {
                 inventory.erase(
                     std::remove_if(inventory.begin(), inventory.end(),
-                        [&itemName](const InventoryItem& i) { return i.name == itemName && i.quantity <= 0; }),
+                        [itemName](const InventoryItem& i) { return i.name == itemName && i.quantity <= 0; }),
                     inventory.end()
                 );
             }
@@ -213,7 +263,7 @@ bool Player::useItem(const std::string& itemName) {
     return false;
 }
 
-bool Player::hasItem(const std::string& itemName) const {
+bool Player::hasItem(std::string_view itemName) const {
     for (const auto& item : inventory) {
         if (item.name == itemName && item.quantity > 0) {
             return true;
@@ -0,0 +1,301 @@
+#include "CaveGenerator.h"
+#include "Config.h"
+#include "UnionFind.h"
+#include <algorithm>
+
+namespace {
+    int countTrailingZeros(uint64_t v) {  // v != 0
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(v);
+#else
+        int n = 0;
+        while (!(v & 1)) {
+            v >>= 1;
+            n++;
+        }
+        return n;
+#endif
+    }
+
+    uint64_t randomWord(std::mt19937& rng) {
+        return ((uint64_t)rng() << 32) | rng();
+    }
+
+    // Flood fill bookkeeping: how each tile was first reached
+    enum : uint8_t { UNVISITED = 0, FROM_LEFT, FROM_RIGHT, FROM_ABOVE, FROM_BELOW, SEED };
+}
+
+CaveGenerator::CaveGenerator(int gridWidth, int gridHeight)
+    : width(gridWidth), height(gridHeight), wordsPerRow((gridWidth + 63) / 64),
+      regionCount(0), linkedCount(0) {
+    size_t words = (size_t)wordsPerRow * height;
+    walls.assign(words, ~uint64_t(0));
+    next.assign(words, ~uint64_t(0));
+    sumLow.resize(words);
+    sumHigh.resize(words);
+}
+
+uint64_t CaveGenerator::paddingMask() const {
+    int used = width & 63;
+    return used == 0 ? 0 : ~uint64_t(0) << used;
+}
+
+void CaveGenerator::setWall(int x, int y, bool wall) {
+    uint64_t& word = walls[(size_t)y * wordsPerRow + (x >> 6)];
+    uint64_t bit = uint64_t(1) << (x & 63);
+    word = wall ? (word | bit) : (word & ~bit);
+}
+
+void CaveGenerator::sealBorder(std::vector<uint64_t>& grid) const {
+    std::fill_n(grid.begin(), wordsPerRow, ~uint64_t(0));
+    std::fill_n(grid.begin() + (size_t)(height - 1) * wordsPerRow, wordsPerRow, ~uint64_t(0));
+
+    uint64_t rightEdge = uint64_t(1) << ((width - 1) & 63);
+    for (int y = 0; y < height; y++) {
+        uint64_t* row = &grid[(size_t)y * wordsPerRow];
+        row[0] |= 1;
+        row[(width - 1) >> 6] |= rightEdge;
+        row[wordsPerRow - 1] |= paddingMask();
+    }
+}
+
+void CaveGenerator::generate(std::mt19937& rng, int smoothingSteps) {
+    randomFill(rng);
+    for (int step = 0; step < smoothingSteps; step++) {
+        smooth();
+    }
+    connectRegions();
+}
+
+void CaveGenerator::randomFill(std::mt19937& rng) {
+    // Each bit is a wall with probability CAVE_INITIAL_WALLS / 16. Going from
+    // the lowest binary digit of the density up, a 1 digit ORs in a random
+    // word and a 0 digit ANDs one, which halves or tops up the probability.
+    const int density = std::clamp(Config::CAVE_INITIAL_WALLS, 0, 16);
+    for (uint64_t& word : walls) {
+        uint64_t bits = density == 16 ? ~uint64_t(0) : 0;
+        for (int digit = 0; digit < 4 && density < 16; digit++) {
+            uint64_t r = randomWord(rng);
+            bits = ((density >> digit) & 1) ? (bits | r) : (bits & r);
+        }
+        word = bits;
+    }
+    sealBorder(walls);
+}
+
+void CaveGenerator::smooth() {
+    // Horizontal pass: each tile's count of walls among itself and its left
+    // and right neighbours, as two bitplanes
+    for (int y = 0; y < height; y++) {
+        const uint64_t* row = &walls[(size_t)y * wordsPerRow];
+        for (int k = 0; k < wordsPerRow; k++) {
+            uint64_t center = row[k];
+            uint64_t left = (center << 1) | (k > 0 ? row[k - 1] >> 63 : 1);
+            uint64_t right = (center >> 1) | ((k + 1 < wordsPerRow ? row[k + 1] : ~uint64_t(0)) << 63);
+
+            size_t i = (size_t)y * wordsPerRow + k;
+            sumLow[i] = left ^ center ^ right;
+            sumHigh[i] = (left & center) | (right & (left ^ center));
+        }
+    }
+
+    // Vertical pass: add the row sums above, here and below. With the total
+    // written as low + 2 * (four high bits), "at least 5 walls" is three or
+    // more high bits set, or two with the low bit set.
+    const uint64_t ALL = ~uint64_t(0);  // A row outside the grid: three walls, 0b11
+    for (int y = 0; y < height; y++) {
+        for (int k = 0; k < wordsPerRow; k++) {
+            size_t i = (size_t)y * wordsPerRow + k;
+            uint64_t aLow = y > 0 ? sumLow[i - wordsPerRow] : ALL;
+            uint64_t aHigh = y > 0 ? sumHigh[i - wordsPerRow] : ALL;
+            uint64_t bLow = sumLow[i];
+            uint64_t bHigh = sumHigh[i];
+            uint64_t cLow = y + 1 < height ? sumLow[i + wordsPerRow] : ALL;
+            uint64_t cHigh = y + 1 < height ? sumHigh[i + wordsPerRow] : ALL;
+
+            uint64_t low = aLow ^ bLow ^ cLow;
+            uint64_t carry = (aLow & bLow) | (cLow & (aLow ^ bLow));
+
+            uint64_t atLeastTwo = (aHigh & bHigh) | (aHigh & cHigh) | (aHigh & carry) |
+                                  (bHigh & cHigh) | (bHigh & carry) | (cHigh & carry);
+            uint64_t atLeastThree = (aHigh & bHigh & (cHigh | carry)) | (cHigh & carry & (aHigh | bHigh));
+            next[i] = atLeastThree | (atLeastTwo & low);
+        }
+    }
+
+    sealBorder(next);
+    walls.swap(next);
+}
+
+void CaveGenerator::findRuns() {
+    runs.clear();
+    rowStart.assign(height + 1, 0);
+
+    for (int y = 0; y < height; y++) {
+        rowStart[y] = (int)runs.size();
+        const uint64_t* row = &walls[(size_t)y * wordsPerRow];
+
+        for (int k = 0; k < wordsPerRow; k++) {
+            uint64_t open = ~row[k];
+            if (k == wordsPerRow - 1) open &= ~paddingMask();
+
+            while (open) {
+                int start = countTrailingZeros(open);
+                uint64_t rest = ~(open >> start);
+                int length = rest ? countTrailingZeros(rest) : 64 - start;
+                int x0 = k * 64 + start;
+
+                // A run that reached the end of the previous word continues here
+                if ((int)runs.size() > rowStart[y] && runs.back().x1 == x0) {
+                    runs.back().x1 = x0 + length;
+                } else {
+                    runs.push_back({y, x0, x0 + length});
+                }
+                open = start + length >= 64 ? 0 : open & (~uint64_t(0) << (start + length));
+            }
+        }
+    }
+    rowStart[height] = (int)runs.size();
+}
+
+void CaveGenerator::connectRegions() {
+    findRuns();
+    const int runCount = (int)runs.size();
+    regionCount = 0;
+    linkedCount = 0;
+    if (runCount == 0) return;
+
+    // Runs in neighbouring rows that overlap share a region. Both rows are
+    // sorted, so one merge-style walk finds every overlap.
+    UnionFind regions(runCount);
+    for (int y = 1; y < height; y++) {
+        int i = rowStart[y - 1], iEnd = rowStart[y];
+        int j = rowStart[y], jEnd = rowStart[y + 1];
+        while (i < iEnd && j < jEnd) {
+            if (runs[i].x0 < runs[j].x1 && runs[j].x0 < runs[i].x1) regions.unite(i, j);
+            if (runs[i].x1 < runs[j].x1) i++;
+            else j++;
+        }
+    }
+
+    std::vector<int> regionTiles(runCount, 0);
+    for (int r = 0; r < runCount; r++) {
+        regionTiles[regions.find(r)] += runs[r].x1 - runs[r].x0;
+    }
+    const int mainRegion = (int)(std::max_element(regionTiles.begin(), regionTiles.end()) - regionTiles.begin());
+
+    // Pockets too small to be worth a tunnel are filled in; the runs of every
+    // other region are grouped so each region can be flooded from
+    std::vector<int> linkRuns;
+    for (int y = 0; y < height; y++) {
+        for (int r = rowStart[y]; r < rowStart[y + 1]; r++) {
+            int region = regions.find(r);
+            if (region == r) regionCount++;
+            if (regionTiles[region] < Config::CAVE_MIN_REGION_TILES) {
+                for (int x = runs[r].x0; x < runs[r].x1; x++) setWall(x, y, true);
+            } else if (region != mainRegion) {
+                linkRuns.push_back(r);
+            }
+        }
+    }
+    if (linkRuns.empty()) return;
+    std::stable_sort(linkRuns.begin(), linkRuns.end(),
+                     [&](int a, int b) { return regions.find(a) < regions.find(b); });
+
+    // Open tiles carved by earlier tunnels belong to no run; every tunnel
+    // ends in the main region, so they count as part of it
+    auto reachesMain = [&](int x, int y) {
+        auto first = runs.begin() + rowStart[y];
+        auto last = runs.begin() + rowStart[y + 1];
+        auto it = std::upper_bound(first, last, x, [](int value, const Run& run) { return value < run.x0; });
+        if (it == first || x >= (it - 1)->x1) return true;
+        return regions.find((int)(it - runs.begin()) - 1) == regions.find(mainRegion);
+    };
+
+    // Flood outward from each region, through rock and open tiles alike,
+    // until the fill touches the main region, then carve back along the fill.
+    // Regions are small next to the main cave, so each fill covers only the
+    // region and the rock around it. Tiles carry the id of the last fill that
+    // visited them, so nothing is cleared between fills.
+    std::vector<int> visitedBy((size_t)width * height, -1);
+    std::vector<uint8_t> from((size_t)width * height, UNVISITED);
+    std::vector<int> queue;
+
+    const int dx[4] = {1, -1, 0, 0};
+    const int dy[4] = {0, 0, 1, -1};
+    const uint8_t arrival[4] = {FROM_LEFT, FROM_RIGHT, FROM_ABOVE, FROM_BELOW};
+
+    for (size_t group = 0; group < linkRuns.size();) {
+        const int region = regions.find(linkRuns[group]);
+        size_t groupEnd = group;
+        while (groupEnd < linkRuns.size() && regions.find(linkRuns[groupEnd]) == region) groupEnd++;
+
+        // An earlier tunnel may already have passed through this region
+        if (region == regions.find(mainRegion)) {
+            group = groupEnd;
+            continue;
+        }
+
+        queue.clear();
+        for (size_t k = group; k < groupEnd; k++) {
+            const Run& run = runs[linkRuns[k]];
+            for (int x = run.x0; x < run.x1; x++) {
+                int index = run.y * width + x;
+                visitedBy[index] = region;
+                from[index] = SEED;
+                queue.push_back(index);
+            }
+        }
+        group = groupEnd;
+
+        int reached = -1;
+        for (size_t head = 0; head < queue.size() && reached < 0; head++) {
+            int x = queue[head] % width;
+            int y = queue[head] / width;
+
+            for (int d = 0; d < 4; d++) {
+                int nx = x + dx[d];
+                int ny = y + dy[d];
+                if (nx < 1 || nx >= width - 1 || ny < 1 || ny >= height - 1) continue;
+
+                int index = ny * width + nx;
+                if (visitedBy[index] == region) continue;
+                visitedBy[index] = region;
+                from[index] = arrival[d];
+
+                if (!isWall(nx, ny) && reachesMain(nx, ny)) {
+                    reached = index;
+                    break;
+                }
+                queue.push_back(index);
+            }
+        }
+        if (reached < 0) continue;
+
+        // Carve a two-tile-wide tunnel back to the region. Other regions it
+        // crosses are joined to the main one along with it.
+        int x = reached % width;
+        int y = reached / width;
+        while (from[(size_t)y * width + x] != SEED) {
+            if (!isWall(x, y)) {
+                auto first = runs.begin() + rowStart[y];
+                auto it = std::upper_bound(first, runs.begin() + rowStart[y + 1], x,
+                                           [](int value, const Run& run) { return value < run.x0; });
+                if (it != first && x < (it - 1)->x1) regions.unite((int)(it - runs.begin()) - 1, mainRegion);
+            }
+            for (int oy = 0; oy < 2; oy++) {
+                for (int ox = 0; ox < 2; ox++) {
+                    if (x + ox < width - 1 && y + oy < height - 1) setWall(x + ox, y + oy, false);
+                }
+            }
+            switch (from[(size_t)y * width + x]) {
+                case FROM_LEFT: x--; break;
+                case FROM_RIGHT: x++; break;
+                case FROM_ABOVE: y--; break;
+                default: y++; break;
+            }
+        }
+        regions.unite(region, mainRegion);
+        linkedCount++;
+    }
+}
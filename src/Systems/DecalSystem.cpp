@@ -0,0 +1,182 @@
+#include "DecalSystem.h"
+#include "MapGenerator.h"
+#include "QuadBatch.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    float randomUnit(uint32_t& state) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return (state & 0xFFFFFF) / (float)0x1000000;
+    }
+}
+
+DecalSystem::DecalSystem()
+    : chunksX(0), chunksY(0), pendingCount(0), clearRequested(false), rngState(0x9E3779B9u) {}
+
+DecalSystem::~DecalSystem() {
+    unload();
+}
+
+void DecalSystem::unload() {
+    for (auto& chunk : chunks) {
+        if (chunk.id != 0) UnloadRenderTexture(chunk);
+    }
+    chunks.clear();
+    chunksX = chunksY = 0;
+    pendingCount = 0;
+}
+
+void DecalSystem::stamp(DecalType type, Vector2 position, float size) {
+    if (pendingCount >= Config::MAX_PENDING_DECALS) return;
+
+    randomUnit(rngState);
+    pending[pendingCount++] = {type, position, size, rngState};
+}
+
+void DecalSystem::clear() {
+    pendingCount = 0;
+    clearRequested = true;
+}
+
+void DecalSystem::flush(const MapGenerator& map) {
+    const int chunkSize = Config::DECAL_CHUNK_SIZE;
+    int neededX = (map.getMapWidth() * map.getTileSize() + chunkSize - 1) / chunkSize;
+    int neededY = (map.getMapHeight() * map.getTileSize() + chunkSize - 1) / chunkSize;
+
+    if (neededX != chunksX || neededY != chunksY) {
+        unload();
+        chunksX = neededX;
+        chunksY = neededY;
+        chunks.assign((size_t)chunksX * chunksY, RenderTexture2D{});
+        clearRequested = false;
+    }
+
+    if (clearRequested) {
+        for (auto& chunk : chunks) {
+            if (chunk.id == 0) continue;
+
+            BeginTextureMode(chunk);
+            ClearBackground(BLANK);
+            EndTextureMode();
+        }
+        clearRequested = false;
+    }
+
+    if (pendingCount == 0) return;
+
+    for (int cy = 0; cy < chunksY; cy++) {
+        for (int cx = 0; cx < chunksX; cx++) {
+            Rectangle chunkRect = {(float)(cx * chunkSize), (float)(cy * chunkSize), (float)chunkSize, (float)chunkSize};
+            RenderTexture2D& chunk = chunks[(size_t)cy * chunksX + cx];
+            bool started = false;
+
+            for (int i = 0; i < pendingCount; i++) {
+                const PendingDecal& decal = pending[i];
+                float reach = decal.size * 2.0f; // Splatter can land outside the core radius
+                Rectangle bounds = {decal.position.x - reach, decal.position.y - reach, reach * 2, reach * 2};
+                if (!CheckCollisionRecs(bounds, chunkRect)) continue;
+
+                if (!started) {
+                    if (chunk.id == 0) {
+                        chunk = LoadRenderTexture(chunkSize, chunkSize);
+                        BeginTextureMode(chunk);
+                        ClearBackground(BLANK);
+                        EndTextureMode();
+                    }
+
+                    // Accumulate premultiplied colour with correct coverage, so the
+                    // chunk can be blitted with premultiplied blending
+                    BeginTextureMode(chunk);
+                    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                                              RL_FUNC_ADD, RL_FUNC_ADD);
+                    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+                    QuadBatch::begin();
+                    started = true;
+                }
+
+                paint(decal, Vector2{-chunkRect.x, -chunkRect.y});
+            }
+
+            if (started) {
+                QuadBatch::end();
+                EndBlendMode();
+                EndTextureMode();
+            }
+        }
+    }
+
+    pendingCount = 0;
+}
+
+void DecalSystem::paint(const PendingDecal& decal, Vector2 offset) {
+    uint32_t state = decal.seed;
+    Vector2 center = {decal.position.x + offset.x, decal.position.y + offset.y};
+    float size = decal.size;
+
+    switch (decal.type) {
+        case DecalType::BLOOD: {
+            QuadBatch::addCircle(center, size, Color{120, 0, 0, 170});
+            for (int i = 0; i < 6; i++) {
+                float angle = randomUnit(state) * 2.0f * PI;
+                float distance = size * (0.6f + randomUnit(state) * 0.9f);
+                Vector2 drop = {center.x + cosf(angle) * distance, center.y + sinf(angle) * distance};
+                QuadBatch::addCircle(drop, size * (0.15f + randomUnit(state) * 0.25f), Color{140, 10, 10, 180});
+            }
+            break;
+        }
+
+        case DecalType::SCORCH:
+            QuadBatch::addCircle(center, size, Color{20, 15, 10, 140});
+            QuadBatch::addCircle(center, size * 0.6f, Color{40, 30, 20, 120});
+            break;
+
+        case DecalType::FROST: {
+            QuadBatch::addCircle(center, size, Color{150, 210, 255, 70});
+            float rotation = randomUnit(state) * PI;
+            for (int spoke = 0; spoke < 6; spoke++) {
+                float angle = rotation + spoke * PI / 3.0f;
+                Vector2 tip = {center.x + cosf(angle) * size, center.y + sinf(angle) * size};
+                QuadBatch::addLine(center, tip, 1.5f, Color{220, 240, 255, 110});
+            }
+            break;
+        }
+    }
+}
+
+void DecalSystem::draw(Rectangle view) const {
+    const int chunkSize = Config::DECAL_CHUNK_SIZE;
+    bool blending = false;
+
+    for (int cy = 0; cy < chunksY; cy++) {
+        for (int cx = 0; cx < chunksX; cx++) {
+            const RenderTexture2D& chunk = chunks[(size_t)cy * chunksX + cx];
+            if (chunk.id == 0) continue;
+
+            Rectangle chunkRect = {(float)(cx * chunkSize), (float)(cy * chunkSize), (float)chunkSize, (float)chunkSize};
+            if (!CheckCollisionRecs(view, chunkRect)) continue;
+
+            if (!blending) {
+                BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+                blending = true;
+            }
+
+            // Render textures are stored bottom-up, hence the negative source height
+            Rectangle source = {0.0f, 0.0f, (float)chunkSize, -(float)chunkSize};
+            DrawTextureRec(chunk.texture, source, Vector2{chunkRect.x, chunkRect.y}, WHITE);
+        }
+    }
+
+    if (blending) EndBlendMode();
+}
+
+int DecalSystem::getAllocatedChunkCount() const {
+    int count = 0;
+    for (const auto& chunk : chunks) {
+        if (chunk.id != 0) count++;
+    }
+    return count;
+}
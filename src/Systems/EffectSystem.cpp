@@ -1,119 +1,242 @@
 #include "EffectSystem.h"
+#include "QuadBatch.h"
+#include "LightingSystem.h"
 #include <cmath>
 
+namespace {
+    float getProgress(const Effect& effect) {
+        return 1.0f - (effect.timeLeft / effect.duration);
+    }
+
+    unsigned char getAlpha(float progress) {
+        return (unsigned char)(255 * (1.0f - progress));
+    }
+}
+
+void EffectSystem::add(EffectType type, Vector2 from, Vector2 to, float duration, float size) {
+    EffectPool& pool = pools[(std::size_t)type];
+
+    // Hard cap: when a type is saturated, replace the effect closest to finishing
+    int slot = pool.count;
+    if (slot == Config::MAX_EFFECTS_PER_TYPE) {
+        slot = 0;
+        for (int i = 1; i < pool.count; i++) {
+            if (pool.effects[i].timeLeft < pool.effects[slot].timeLeft) slot = i;
+        }
+    } else {
+        pool.count++;
+    }
+
+    pool.effects[slot] = Effect(from, to, duration, size);
+}
+
 void EffectSystem::addSpellCastReady(Vector2 position) {
-    effects.emplace_back(position, EffectType::SPELL_CAST_READY, 0.5f, 15.0f);
+    add(EffectType::SPELL_CAST_READY, position, position, 0.5f, 15.0f);
 }
 
 void EffectSystem::addShieldActivate(Vector2 position) {
-    effects.emplace_back(position, EffectType::SHIELD_ACTIVATE, 1.0f, 40.0f);
+    add(EffectType::SHIELD_ACTIVATE, position, position, 1.0f, 40.0f);
 }
 
 void EffectSystem::addItemThrow(Vector2 from, Vector2 to) {
-    effects.emplace_back(from, EffectType::ITEM_THROW, 0.3f, 5.0f);
+    add(EffectType::ITEM_THROW, from, to, 0.3f, 5.0f);
 }
 
 void EffectSystem::addFireball(Vector2 position) {
-    effects.emplace_back(position, EffectType::FIREBALL, 0.6f, 20.0f);
+    add(EffectType::FIREBALL, position, position, 0.6f, 20.0f);
 }
 
 void EffectSystem::addFrostWave(Vector2 position) {
-    effects.emplace_back(position, EffectType::FROST_WAVE, 0.8f, 30.0f);
+    add(EffectType::FROST_WAVE, position, position, 0.8f, 30.0f);
 }
 
 void EffectSystem::addChainLightning(Vector2 from, Vector2 to) {
-    effects.emplace_back(from, EffectType::CHAIN_LIGHTNING, 0.4f, 5.0f);
+    add(EffectType::CHAIN_LIGHTNING, from, to, 0.4f, 5.0f);
 }
 
 void EffectSystem::addWhirlwind(Vector2 position) {
-    effects.emplace_back(position, EffectType::WHIRLWIND_SPIN, 1.0f, 40.0f);
+    add(EffectType::WHIRLWIND_SPIN, position, position, 1.0f, 40.0f);
 }
 
 void EffectSystem::update(float deltaTime) {
-    for (auto it = effects.begin(); it != effects.end();) {
-        it->timeLeft -= deltaTime;
-        it->size += deltaTime * 50.0f;
-
-        if (it->timeLeft <= 0) {
-            it = effects.erase(it);
-        } else {
-            ++it;
+    for (auto& pool : pools) {
+        for (int i = 0; i < pool.count;) {
+            Effect& effect = pool.effects[i];
+            effect.timeLeft -= deltaTime;
+            effect.size += deltaTime * 50.0f;
+
+            if (effect.timeLeft <= 0) {
+                pool.effects[i] = pool.effects[--pool.count]; // Swap-remove
+            } else {
+                ++i;
+            }
         }
     }
 }
 
 void EffectSystem::draw() {
-    for (const auto& effect : effects) {
-        float progress = 1.0f - (effect.timeLeft / effect.duration);
-        unsigned char alpha = (unsigned char)(255 * (1.0f - progress));
-
-        switch (effect.type) {
-            case EffectType::FIREBALL: {
-                Color fireColor = Color{255, 165, 0, alpha};
-                DrawCircleV(effect.position, effect.size * progress, fireColor);
-                DrawCircleV(effect.position, effect.size * progress * 0.6f, Color{255, 255, 0, alpha});
-                break;
-            }
+    if (getEffectCount() == 0) return;
+
+    QuadBatch::begin();
+    drawFrostWaves(pools[(std::size_t)EffectType::FROST_WAVE]);
+    drawSpellCastReady(pools[(std::size_t)EffectType::SPELL_CAST_READY]);
+    drawShieldActivate(pools[(std::size_t)EffectType::SHIELD_ACTIVATE]);
+    drawWhirlwinds(pools[(std::size_t)EffectType::WHIRLWIND_SPIN]);
+    drawFireballs(pools[(std::size_t)EffectType::FIREBALL]);
+    drawChainLightning(pools[(std::size_t)EffectType::CHAIN_LIGHTNING]);
+    drawItemThrows(pools[(std::size_t)EffectType::ITEM_THROW]);
+    QuadBatch::end();
+}
 
-            case EffectType::CHAIN_LIGHTNING: {
-                Color lightningColor = Color{200, 220, 255, alpha};
-                DrawCircleV(effect.position, effect.size * progress, lightningColor);
-                break;
-            }
+void EffectSystem::addLights(LightingSystem& lighting) const {
+    const EffectPool& fireballs = pools[(std::size_t)EffectType::FIREBALL];
+    for (int i = 0; i < fireballs.count; i++) {
+        const Effect& effect = fireballs.effects[i];
+        lighting.addDynamicLight(effect.position, 90.0f, Color{255, 140, 40, getAlpha(getProgress(effect))});
+    }
 
-            case EffectType::FROST_WAVE: {
-                Color frostColor = Color{0, 200, 255, alpha};
-                DrawCircleLines((int)effect.position.x, (int)effect.position.y,
-                               (int)(effect.size * progress), frostColor);
-                DrawCircleLines((int)effect.position.x, (int)effect.position.y,
-                               (int)(effect.size * progress * 0.6f), frostColor);
-                break;
-            }
+    const EffectPool& frostWaves = pools[(std::size_t)EffectType::FROST_WAVE];
+    for (int i = 0; i < frostWaves.count; i++) {
+        const Effect& effect = frostWaves.effects[i];
+        lighting.addDynamicLight(effect.position, 120.0f, Color{60, 160, 255, getAlpha(getProgress(effect))});
+    }
 
-            case EffectType::WHIRLWIND_SPIN: {
-                Color windColor = Color{200, 100, 255, alpha};
-                float rotation = progress * 360.0f * 4.0f;
-
-                for (int i = 0; i < 8; i++) {
-                    float angle = (i * 45.0f + rotation) * 3.14159f / 180.0f;
-                    DrawLineEx(
-                        effect.position,
-                        {effect.position.x + cos(angle) * effect.size,
-                         effect.position.y + sin(angle) * effect.size},
-                        2.0f, windColor
-                    );
-                }
-                break;
-            }
+    const EffectPool& lightning = pools[(std::size_t)EffectType::CHAIN_LIGHTNING];
+    for (int i = 0; i < lightning.count; i++) {
+        const Effect& effect = lightning.effects[i];
+        lighting.addDynamicLight(effect.target, 70.0f, Color{180, 200, 255, getAlpha(getProgress(effect))});
+    }
+}
 
-            case EffectType::SPELL_CAST_READY: {
-                Color readyColor = Color{0, 255, 136, alpha};
-                DrawCircleLines((int)effect.position.x, (int)effect.position.y,
-                               (int)(effect.size * progress), readyColor);
-                DrawCircleLines((int)effect.position.x, (int)effect.position.y,
-                               (int)(effect.size * progress * 0.6f), readyColor);
-                break;
-            }
+void EffectSystem::drawFireballs(const EffectPool& pool) {
+    for (int i = 0; i < pool.count; i++) {
+        const Effect& effect = pool.effects[i];
+        float progress = getProgress(effect);
+        unsigned char alpha = getAlpha(progress);
 
-            case EffectType::SHIELD_ACTIVATE: {
-                Color shieldColor = Color{173, 216, 230, alpha};
-                DrawCircle((int)effect.position.x, (int)effect.position.y,
-                          (int)(effect.size * progress), Fade(shieldColor, 0.3f));
-                DrawCircleLines((int)effect.position.x, (int)effect.position.y,
-                               (int)(effect.size * progress), shieldColor);
-                break;
-            }
+        QuadBatch::addCircle(effect.position, effect.size * progress, Color{255, 165, 0, alpha});
+        QuadBatch::addCircle(effect.position, effect.size * progress * 0.6f, Color{255, 255, 0, alpha});
+    }
+}
+
+void EffectSystem::drawFrostWaves(const EffectPool& pool) {
+    for (int i = 0; i < pool.count; i++) {
+        const Effect& effect = pool.effects[i];
+        float progress = getProgress(effect);
+        Color frostColor = Color{0, 200, 255, getAlpha(progress)};
 
-            case EffectType::ITEM_THROW: {
-                Color itemColor = Color{255, 215, 0, alpha};
-                DrawCircle((int)effect.position.x, (int)effect.position.y, 3, itemColor);
-                break;
+        QuadBatch::addRing(effect.position, effect.size * progress, 1.0f, frostColor);
+        QuadBatch::addRing(effect.position, effect.size * progress * 0.6f, 1.0f, frostColor);
+    }
+}
+
+void EffectSystem::drawChainLightning(const EffectPool& pool) {
+    constexpr int SEGMENTS = 6;
+
+    for (int i = 0; i < pool.count; i++) {
+        const Effect& effect = pool.effects[i];
+        float progress = getProgress(effect);
+        Color lightningColor = Color{200, 220, 255, getAlpha(progress)};
+
+        float dx = effect.target.x - effect.position.x;
+        float dy = effect.target.y - effect.position.y;
+        float length = std::sqrt(dx * dx + dy * dy);
+        if (length < 1.0f) {
+            QuadBatch::addCircle(effect.position, effect.size * progress, lightningColor);
+            continue;
+        }
+
+        // Jagged bolt: jitter the inner points along the normal. The jitter is
+        // derived from the effect's timer so it flickers while it fades.
+        float nx = -dy / length;
+        float ny = dx / length;
+        unsigned int seed = (unsigned int)(effect.timeLeft * 60.0f) * 2654435761u + (unsigned int)i;
+
+        Vector2 previous = effect.position;
+        for (int s = 1; s <= SEGMENTS; s++) {
+            float t = (float)s / SEGMENTS;
+            Vector2 point = {effect.position.x + dx * t, effect.position.y + dy * t};
+
+            if (s < SEGMENTS) {
+                seed = seed * 1664525u + 1013904223u;
+                float jitter = ((float)(seed >> 16) / 65535.0f - 0.5f) * 16.0f;
+                point.x += nx * jitter;
+                point.y += ny * jitter;
             }
+
+            QuadBatch::addLine(previous, point, 2.0f, lightningColor);
+            previous = point;
         }
+
+        QuadBatch::addCircle(effect.target, effect.size * progress, lightningColor);
+    }
+}
+
+void EffectSystem::drawWhirlwinds(const EffectPool& pool) {
+    for (int i = 0; i < pool.count; i++) {
+        const Effect& effect = pool.effects[i];
+        float progress = getProgress(effect);
+        Color windColor = Color{200, 100, 255, getAlpha(progress)};
+        float rotation = progress * 360.0f * 4.0f;
+
+        for (int spoke = 0; spoke < 8; spoke++) {
+            float angle = (spoke * 45.0f + rotation) * 3.14159f / 180.0f;
+            QuadBatch::addLine(
+                effect.position,
+                {effect.position.x + cosf(angle) * effect.size,
+                 effect.position.y + sinf(angle) * effect.size},
+                2.0f, windColor
+            );
+        }
+    }
+}
+
+void EffectSystem::drawSpellCastReady(const EffectPool& pool) {
+    for (int i = 0; i < pool.count; i++) {
+        const Effect& effect = pool.effects[i];
+        float progress = getProgress(effect);
+        Color readyColor = Color{0, 255, 136, getAlpha(progress)};
+
+        QuadBatch::addRing(effect.position, effect.size * progress, 1.0f, readyColor);
+        QuadBatch::addRing(effect.position, effect.size * progress * 0.6f, 1.0f, readyColor);
+    }
+}
+
+void EffectSystem::drawShieldActivate(const EffectPool& pool) {
+    for (int i = 0; i < pool.count; i++) {
+        const Effect& effect = pool.effects[i];
+        float progress = getProgress(effect);
+        Color shieldColor = Color{173, 216, 230, getAlpha(progress)};
+
+        QuadBatch::addCircle(effect.position, effect.size * progress, Fade(shieldColor, 0.3f));
+        QuadBatch::addRing(effect.position, effect.size * progress, 1.0f, shieldColor);
+    }
+}
+
+void EffectSystem::drawItemThrows(const EffectPool& pool) {
+    for (int i = 0; i < pool.count; i++) {
+        const Effect& effect = pool.effects[i];
+        float progress = getProgress(effect);
+
+        // Travel from the thrower to the target over the effect's lifetime
+        Vector2 position = {
+            effect.position.x + (effect.target.x - effect.position.x) * progress,
+            effect.position.y + (effect.target.y - effect.position.y) * progress
+        };
+        QuadBatch::addCircle(position, 3.0f, Color{255, 215, 0, (unsigned char)(255 - 128 * progress)});
     }
 }
 
 void EffectSystem::clear() {
-    effects.clear();
+    for (auto& pool : pools) {
+        pool.count = 0;
+    }
 }
 
+int EffectSystem::getEffectCount() const {
+    int total = 0;
+    for (const auto& pool : pools) {
+        total += pool.count;
+    }
+    return total;
+}
@@ -0,0 +1,206 @@
+#include "FieldOfView.h"
+#include "MapGenerator.h"
+#include "Config.h"
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    // Octant transforms: (xx, xy, yx, yy) for each of the eight octants
+    constexpr int OCTANTS[8][4] = {
+        { 1,  0,  0,  1}, { 0,  1,  1,  0}, { 0, -1,  1,  0}, {-1,  0,  0,  1},
+        {-1,  0,  0, -1}, { 0, -1, -1,  0}, { 0,  1, -1,  0}, { 1,  0,  0, -1}
+    };
+
+    size_t wordCount(int width, int height) {
+        return ((size_t)width * height + 63) / 64;
+    }
+
+    bool blocksSight(const MapGenerator& map, int x, int y) {
+        return map.getTileType(x, y) == TileType::WALL;
+    }
+}
+
+FieldOfView::FieldOfView()
+    : mapWidth(0), mapHeight(0), tileSize(Config::TILE_SIZE), mapGeneration(0),
+      exploredVersion(0), originX(-1), originY(-1), valid(false) {}
+
+void FieldOfView::reset(const MapGenerator& map) {
+    mapWidth = map.getMapWidth();
+    mapHeight = map.getMapHeight();
+    tileSize = map.getTileSize();
+    mapGeneration = map.getGeneration();
+
+    visible.assign(wordCount(mapWidth, mapHeight), 0);
+    explored.assign(wordCount(mapWidth, mapHeight), 0);
+    exploredVersion++;
+    valid = false;
+}
+
+void FieldOfView::update(const MapGenerator& map, Vector2 viewerCenter) {
+    if (map.getGeneration() != mapGeneration || visible.empty()) {
+        reset(map);
+    }
+
+    int tileX = (int)(viewerCenter.x / tileSize);
+    int tileY = (int)(viewerCenter.y / tileSize);
+    if (valid && tileX == originX && tileY == originY) return;
+
+    originX = tileX;
+    originY = tileY;
+    compute(map);
+    valid = true;
+}
+
+void FieldOfView::compute(const MapGenerator& map) {
+    std::fill(visible.begin(), visible.end(), 0);
+
+    markVisible(originX, originY);
+    for (const auto& octant : OCTANTS) {
+        castLight(map, 1, 1.0f, 0.0f, octant[0], octant[1], octant[2], octant[3]);
+    }
+}
+
+void FieldOfView::castLight(const MapGenerator& map, int row, float startSlope, float endSlope,
+                            int xx, int xy, int yx, int yy) {
+    if (startSlope < endSlope) return;
+
+    const int radius = Config::FOV_RADIUS;
+    const int radiusSquared = radius * radius;
+    float nextStart = startSlope;
+
+    for (int distance = row; distance <= radius; distance++) {
+        bool blocked = false;
+        int dy = -distance;
+
+        for (int dx = -distance; dx <= 0; dx++) {
+            int x = originX + dx * xx + dy * xy;
+            int y = originY + dx * yx + dy * yy;
+
+            float leftSlope = (dx - 0.5f) / (dy + 0.5f);
+            float rightSlope = (dx + 0.5f) / (dy - 0.5f);
+
+            if (startSlope < rightSlope) continue;
+            if (endSlope > leftSlope) break;
+
+            if (dx * dx + dy * dy <= radiusSquared) {
+                markVisible(x, y);
+            }
+
+            bool wall = blocksSight(map, x, y);
+            if (blocked) {
+                if (wall) {
+                    nextStart = rightSlope;
+                    continue;
+                }
+                blocked = false;
+                startSlope = nextStart;
+            } else if (wall && distance < radius) {
+                // Scan the part of the next row that this wall doesn't shadow
+                blocked = true;
+                castLight(map, distance + 1, startSlope, leftSlope, xx, xy, yx, yy);
+                nextStart = rightSlope;
+            }
+        }
+
+        if (blocked) break;
+    }
+}
+
+void FieldOfView::markVisible(int x, int y) {
+    if (x < 0 || x >= mapWidth || y < 0 || y >= mapHeight) return;
+
+    size_t index = (size_t)y * mapWidth + x;
+    uint64_t bit = uint64_t(1) << (index & 63);
+    visible[index >> 6] |= bit;
+
+    if (!(explored[index >> 6] & bit)) {
+        explored[index >> 6] |= bit;
+        exploredVersion++;
+    }
+}
+
+bool FieldOfView::isVisible(int tileX, int tileY) const {
+    if (tileX < 0 || tileX >= mapWidth || tileY < 0 || tileY >= mapHeight) return false;
+    return testBit(visible, (size_t)tileY * mapWidth + tileX);
+}
+
+bool FieldOfView::isExplored(int tileX, int tileY) const {
+    if (tileX < 0 || tileX >= mapWidth || tileY < 0 || tileY >= mapHeight) return false;
+    return testBit(explored, (size_t)tileY * mapWidth + tileX);
+}
+
+bool FieldOfView::isWorldPositionVisible(Vector2 worldPos) const {
+    return isVisible((int)std::floor(worldPos.x / tileSize), (int)std::floor(worldPos.y / tileSize));
+}
+
+void FieldOfView::drawFog(Rectangle view) const {
+    int minX = std::max(0, (int)(view.x / tileSize));
+    int minY = std::max(0, (int)(view.y / tileSize));
+    int maxX = std::min(mapWidth - 1, (int)((view.x + view.width) / tileSize));
+    int maxY = std::min(mapHeight - 1, (int)((view.y + view.height) / tileSize));
+
+    Color unseen = Fade(BLACK, 0.55f);
+
+    for (int y = minY; y <= maxY; y++) {
+        for (int x = minX; x <= maxX; x++) {
+            if (isVisible(x, y)) continue;
+
+            Color color = isExplored(x, y) ? unseen : BLACK;
+            DrawRectangle(x * tileSize, y * tileSize, tileSize, tileSize, color);
+        }
+    }
+}
+
+int FieldOfView::getVisibleCount() const {
+    int count = 0;
+    for (uint64_t word : visible) {
+        count += (int)std::bitset<64>(word).count();
+    }
+    return count;
+}
+
+std::string FieldOfView::exportExplored() const {
+    static const char HEX[] = "0123456789abcdef";
+
+    std::string data;
+    data.reserve(explored.size() * 16);
+    for (uint64_t word : explored) {
+        for (int shift = 60; shift >= 0; shift -= 4) {
+            data += HEX[(word >> shift) & 0xF];
+        }
+    }
+    return data;
+}
+
+bool FieldOfView::importExplored(const MapGenerator& map, const std::string& data) {
+    if (map.getGeneration() != mapGeneration || visible.empty()) {
+        reset(map);
+    }
+
+    if (data.size() != explored.size() * 16) {
+        std::cout << "Warning: Explored tiles in save don't match the map size, ignoring" << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < explored.size(); i++) {
+        uint64_t word = 0;
+        for (size_t c = 0; c < 16; c++) {
+            char ch = data[i * 16 + c];
+            int nibble = (ch >= '0' && ch <= '9') ? ch - '0' :
+                         (ch >= 'a' && ch <= 'f') ? ch - 'a' + 10 : -1;
+            if (nibble < 0) {
+                std::cout << "Warning: Corrupt explored tiles in save, ignoring" << std::endl;
+                std::fill(explored.begin(), explored.end(), 0);
+                return false;
+            }
+            word = (word << 4) | (uint64_t)nibble;
+        }
+        explored[i] = word;
+    }
+
+    exploredVersion++;
+    valid = false;
+    return true;
+}
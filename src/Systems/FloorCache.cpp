@@ -0,0 +1,267 @@
+#include "FloorCache.h"
+#include "ByteStream.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <system_error>
+
+namespace {
+    void encodeSnapshot(const FloorSnapshot& snapshot, std::string& out) {
+        out.clear();
+        ByteWriter writer(out);
+        writer.u32(snapshot.floorSeed);
+        writer.u32(snapshot.layoutChecksum);
+
+        writer.u32((uint32_t)snapshot.tileTypes.size());
+        out.append((const char*)snapshot.tileTypes.data(), snapshot.tileTypes.size());
+
+        writer.u32((uint32_t)snapshot.rooms.size());
+        for (const Room& room : snapshot.rooms) {
+            writer.i32(room.x);
+            writer.i32(room.y);
+            writer.i32(room.width);
+            writer.i32(room.height);
+        }
+
+        writer.u32((uint32_t)snapshot.wallRects.size());
+        for (const WallRect& rect : snapshot.wallRects) {
+            writer.i32(rect.x);
+            writer.i32(rect.y);
+            writer.i32(rect.width);
+            writer.i32(rect.height);
+        }
+
+        writer.u32((uint32_t)snapshot.wallDistance.size());
+        for (uint16_t distance : snapshot.wallDistance) writer.u16(distance);
+
+        writer.u32((uint32_t)snapshot.spawnTiles.size());
+        for (int tile : snapshot.spawnTiles) writer.i32(tile);
+
+        writer.u32((uint32_t)snapshot.decorationPositions.size());
+        for (size_t i = 0; i < snapshot.decorationPositions.size(); i++) {
+            writer.f32(snapshot.decorationPositions[i].x);
+            writer.f32(snapshot.decorationPositions[i].y);
+            writer.i32(snapshot.decorationTypes[i]);
+        }
+    }
+
+    // Colors are four bytes, RGBA, so the pixels are copied as they are
+    static_assert(sizeof(Color) == 4, "lightmap pixels are spilled as raw RGBA");
+
+    void encodeLightmap(const std::vector<Color>& pixels, int lightCount, std::string& out) {
+        ByteWriter writer(out);
+        writer.i32(lightCount);
+        writer.u32((uint32_t)pixels.size());
+        out.append((const char*)pixels.data(), pixels.size() * sizeof(Color));
+    }
+
+    // Reads a list count, refusing counts the remaining bytes can't hold so a
+    // damaged record can't trigger a huge allocation
+    bool readCount(ByteReader& reader, size_t elementSize, uint32_t& count) {
+        return reader.u32(count) && (size_t)count * elementSize <= reader.remaining();
+    }
+
+    bool decodeSnapshot(ByteReader& reader, FloorSnapshot& out) {
+        uint32_t count;
+        if (!reader.u32(out.floorSeed) || !reader.u32(out.layoutChecksum)) return false;
+
+        if (!readCount(reader, 1, count)) return false;
+        out.tileTypes.assign((const uint8_t*)reader.current(), (const uint8_t*)reader.current() + count);
+        reader.skip(count);
+
+        if (!readCount(reader, 16, count)) return false;
+        out.rooms.resize(count);
+        for (Room& room : out.rooms) {
+            reader.i32(room.x);
+            reader.i32(room.y);
+            reader.i32(room.width);
+            reader.i32(room.height);
+        }
+
+        if (!readCount(reader, 16, count)) return false;
+        out.wallRects.resize(count);
+        for (WallRect& rect : out.wallRects) {
+            reader.i32(rect.x);
+            reader.i32(rect.y);
+            reader.i32(rect.width);
+            reader.i32(rect.height);
+        }
+
+        if (!readCount(reader, 2, count)) return false;
+        // The bulk of a snapshot; decoded straight from the bytes rather than
+        // through a bounds check per value
+        out.wallDistance.resize(count);
+        const uint8_t* bytes = (const uint8_t*)reader.current();
+        for (uint32_t i = 0; i < count; i++) {
+            out.wallDistance[i] = (uint16_t)(bytes[2 * i] | (bytes[2 * i + 1] << 8));
+        }
+        reader.skip((size_t)count * 2);
+
+        if (!readCount(reader, 4, count)) return false;
+        out.spawnTiles.resize(count);
+        for (int& tile : out.spawnTiles) reader.i32(tile);
+
+        if (!readCount(reader, 12, count)) return false;
+        out.decorationPositions.resize(count);
+        out.decorationTypes.resize(count);
+        for (uint32_t i = 0; i < count; i++) {
+            reader.f32(out.decorationPositions[i].x);
+            reader.f32(out.decorationPositions[i].y);
+            reader.i32(out.decorationTypes[i]);
+        }
+        return true;
+    }
+
+    bool decodeLightmap(ByteReader& reader, std::vector<Color>& pixels, int& lightCount) {
+        uint32_t count;
+        if (!reader.i32(lightCount) || !readCount(reader, sizeof(Color), count)) return false;
+        pixels.resize(count);
+        std::memcpy(pixels.data(), reader.current(), (size_t)count * sizeof(Color));
+        reader.skip((size_t)count * sizeof(Color));
+        return true;
+    }
+}
+
+FloorCache::FloorCache(const std::string& filename)
+    : spillFilename(filename), spillFile(nullptr), spillSize(0), hits(0), spillHits(0), misses(0) {}
+
+FloorCache::~FloorCache() {
+    closeSpillFile();
+}
+
+void FloorCache::closeSpillFile() {
+    if (!spillFile) return;
+
+    std::fclose(spillFile);
+    spillFile = nullptr;
+    spilled.clear();
+    spillSize = 0;
+
+    std::error_code error;
+    std::filesystem::remove(spillFilename, error);
+}
+
+bool FloorCache::restore(MapGenerator& map, uint32_t runSeed, int floor, uint32_t floorSeed,
+                         std::vector<Color>& lightmap, int& lightCount) {
+    for (size_t i = 0; i < entries.size(); i++) {
+        Entry& entry = entries[i];
+        if (entry.runSeed != runSeed || entry.floor != floor) continue;
+
+        if (entry.snapshot.floorSeed == floorSeed && map.importFloor(entry.snapshot)) {
+            lightmap = entry.lightmap;  // The entry keeps its copy for the next visit
+            lightCount = entry.lightCount;
+            std::rotate(entries.begin(), entries.begin() + i, entries.begin() + i + 1);
+            hits++;
+            std::cout << "Restored floor " << floor << " from the floor cache" << std::endl;
+            return true;
+        }
+        entries.erase(entries.begin() + i);
+        break;
+    }
+
+    // Copy the record: promoting the floor can spill another one, which
+    // appends to (or resets) the spill index
+    SpillRecord record{};
+    bool found = false;
+    for (const SpillRecord& candidate : spilled) {
+        if (candidate.runSeed == runSeed && candidate.floor == floor && candidate.floorSeed == floorSeed) {
+            record = candidate;
+            found = true;
+            break;
+        }
+    }
+
+    Entry entry{runSeed, floor, FloorSnapshot{}, {}, 0};
+    if (found && readSpilled(record, entry) && map.importFloor(entry.snapshot)) {
+        // The record stays in the file, so evicting this floor again is free
+        lightmap = entry.lightmap;
+        lightCount = entry.lightCount;
+        insert(std::move(entry));
+        spillHits++;
+        std::cout << "Restored floor " << floor << " from the floor cache spill file" << std::endl;
+        return true;
+    }
+
+    misses++;
+    return false;
+}
+
+void FloorCache::store(const MapGenerator& map, uint32_t runSeed, int floor,
+                       const std::vector<Color>& lightmap, int lightCount) {
+    Entry entry{runSeed, floor, FloorSnapshot{}, lightmap, lightCount};
+    map.exportFloor(entry.snapshot);
+    insert(std::move(entry));
+}
+
+void FloorCache::insert(Entry&& entry) {
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (entries[i].runSeed == entry.runSeed && entries[i].floor == entry.floor) {
+            entries.erase(entries.begin() + i);
+            break;
+        }
+    }
+
+    entries.insert(entries.begin(), std::move(entry));
+    if ((int)entries.size() > Config::FLOOR_CACHE_SIZE) {
+        spill(entries.back());
+        entries.pop_back();
+    }
+}
+
+void FloorCache::spill(const Entry& entry) {
+    for (const SpillRecord& record : spilled) {
+        if (record.runSeed == entry.runSeed && record.floor == entry.floor &&
+            record.floorSeed == entry.snapshot.floorSeed) {
+            return;
+        }
+    }
+
+    encodeSnapshot(entry.snapshot, buffer);
+    encodeLightmap(entry.lightmap, entry.lightCount, buffer);
+    if (spillSize + (long)buffer.size() > Config::FLOOR_CACHE_SPILL_BYTES) {
+        closeSpillFile();
+    }
+
+    if (!spillFile) {
+        std::error_code error;
+        std::filesystem::path target(spillFilename);
+        if (target.has_parent_path()) {
+            std::filesystem::create_directories(target.parent_path(), error);
+        }
+        spillFile = std::fopen(spillFilename.c_str(), "w+b");
+        if (!spillFile) {
+            std::cerr << "Failed to open floor cache spill file: " << spillFilename << std::endl;
+            return;
+        }
+    }
+
+    if (std::fseek(spillFile, spillSize, SEEK_SET) != 0 ||
+        std::fwrite(buffer.data(), 1, buffer.size(), spillFile) != buffer.size() ||
+        std::fflush(spillFile) != 0) {
+        std::cerr << "Failed to spill floor " << entry.floor << " to " << spillFilename << std::endl;
+        return;
+    }
+
+    spilled.push_back({entry.runSeed, entry.floor, entry.snapshot.floorSeed, spillSize,
+                       (uint32_t)buffer.size(), crc32(buffer.data(), buffer.size())});
+    spillSize += (long)buffer.size();
+}
+
+bool FloorCache::readSpilled(const SpillRecord& record, Entry& out) {
+    if (!spillFile) return false;
+
+    buffer.resize(record.size);
+    if (std::fseek(spillFile, record.offset, SEEK_SET) != 0 ||
+        std::fread(&buffer[0], 1, buffer.size(), spillFile) != buffer.size()) {
+        std::cerr << "Failed to read floor " << record.floor << " back from " << spillFilename << std::endl;
+        return false;
+    }
+    if (crc32(buffer.data(), buffer.size()) != record.checksum) {
+        std::cerr << "Warning: spilled floor " << record.floor << " is damaged" << std::endl;
+        return false;
+    }
+    ByteReader reader(buffer.data(), buffer.size());
+    return decodeSnapshot(reader, out.snapshot) && decodeLightmap(reader, out.lightmap, out.lightCount) &&
+           reader.remaining() == 0;
+}
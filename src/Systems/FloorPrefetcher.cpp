@@ -0,0 +1,82 @@
+#include "FloorPrefetcher.h"
+#include "LightingSystem.h"
+#include <iostream>
+
+FloorPrefetcher::FloorPrefetcher()
+    : map(std::make_unique<MapGenerator>(Config::MAP_WIDTH, Config::MAP_HEIGHT, Config::TILE_SIZE)),
+      hasPending(false), working(false), stopping(false), hasReady(false), hasRequested(false),
+      busy(false), preparedCount(0), usedCount(0) {
+    worker = std::thread(&FloorPrefetcher::run, this);
+}
+
+FloorPrefetcher::~FloorPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    worker.join();  // A floor being built is finished, anything queued is dropped
+}
+
+void FloorPrefetcher::request(uint32_t runSeed, int floor, uint32_t floorSeed) {
+    if (hasRequested && requested.matches(runSeed, floor, floorSeed)) return;
+
+    requested = {runSeed, floor, floorSeed};
+    hasRequested = true;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = requested;
+        hasPending = true;
+        busy = true;
+    }
+    wake.notify_one();
+}
+
+bool FloorPrefetcher::take(uint32_t runSeed, int floor, uint32_t floorSeed, PreparedFloor& out) {
+    if (!hasRequested || !requested.matches(runSeed, floor, floorSeed)) return false;
+    hasRequested = false;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return !hasPending && !working; });
+    if (!hasReady || ready.runSeed != runSeed || ready.floor != floor || ready.snapshot.floorSeed != floorSeed) {
+        return false;
+    }
+
+    out = std::move(ready);
+    hasReady = false;
+    usedCount++;
+    return true;
+}
+
+void FloorPrefetcher::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        wake.wait(lock, [this] { return hasPending || stopping; });
+        if (stopping) break;
+
+        Job job = pending;
+        hasPending = false;
+        working = true;
+        lock.unlock();
+
+        PreparedFloor floor;
+        floor.runSeed = job.runSeed;
+        floor.floor = job.floor;
+        map->generateFloor(job.floor, job.floorSeed);
+        map->exportFloor(floor.snapshot);
+        floor.lightCount = LightingSystem::bakeLightmap(*map, floor.lightmap);
+        preparedCount++;
+
+        lock.lock();
+        ready = std::move(floor);
+        hasReady = true;
+        working = false;
+        busy = hasPending;
+        if (!hasPending) finished.notify_all();
+    }
+
+    working = false;
+    busy = false;
+    finished.notify_all();
+}
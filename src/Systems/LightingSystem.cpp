@@ -0,0 +1,205 @@
+#include "LightingSystem.h"
+#include "MapGenerator.h"
+#include "QuadBatch.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+namespace {
+    struct StaticLightType {
+        float radius;      // In tiles
+        float intensity;
+        float r, g, b;
+    };
+
+    // Indexed by decorativeTypes: 0=water, 1=magic stone, 2=torch, 3=rune
+    constexpr StaticLightType STATIC_LIGHTS[] = {
+        {3.0f, 0.35f, 0.4f, 0.7f, 1.0f},
+        {4.0f, 0.55f, 0.7f, 0.5f, 1.0f},
+        {7.0f, 0.90f, 1.0f, 0.75f, 0.45f},
+        {3.5f, 0.45f, 0.8f, 0.4f, 1.0f},
+    };
+
+    // Walls between the two tiles (exclusive of both ends) block the light
+    bool hasLineOfSight(const MapGenerator& map, int x0, int y0, int x1, int y1) {
+        int dx = std::abs(x1 - x0);
+        int dy = -std::abs(y1 - y0);
+        int stepX = x0 < x1 ? 1 : -1;
+        int stepY = y0 < y1 ? 1 : -1;
+        int error = dx + dy;
+
+        int x = x0, y = y0;
+        while (true) {
+            if (x == x1 && y == y1) return true;
+            if ((x != x0 || y != y0) && map.getTileType(x, y) == TileType::WALL) return false;
+
+            int error2 = 2 * error;
+            if (error2 >= dy) { error += dy; x += stepX; }
+            if (error2 <= dx) { error += dx; y += stepY; }
+        }
+    }
+}
+
+LightingSystem::LightingSystem()
+    : lightmap({}), bakedGeneration(0), baked(false), bakedLightCount(0), dynamicLightCount(0) {}
+
+LightingSystem::~LightingSystem() {
+    unload();
+}
+
+void LightingSystem::unload() {
+    if (lightmap.id != 0) {
+        UnloadTexture(lightmap);
+        lightmap = {};
+    }
+    baked = false;
+}
+
+void LightingSystem::bake(const MapGenerator& map) {
+    int lightCount = bakeLightmap(map, lightmapPixels);
+    uploadLightmap(map, lightCount);
+}
+
+void LightingSystem::adoptLightmap(const MapGenerator& map, std::vector<Color>&& pixels, int lightCount) {
+    const int texelsPerTile = Config::LIGHTMAP_TEXELS_PER_TILE;
+    if (pixels.size() != (size_t)map.getMapWidth() * texelsPerTile * map.getMapHeight() * texelsPerTile) {
+        bake(map);
+        return;
+    }
+    lightmapPixels = std::move(pixels);
+    uploadLightmap(map, lightCount);
+}
+
+int LightingSystem::bakeLightmap(const MapGenerator& map, std::vector<Color>& pixels) {
+    const int texelsPerTile = Config::LIGHTMAP_TEXELS_PER_TILE;
+    const int mapWidth = map.getMapWidth();
+    const int mapHeight = map.getMapHeight();
+    const int tileSize = map.getTileSize();
+    const int width = mapWidth * texelsPerTile;
+    const int height = mapHeight * texelsPerTile;
+
+    std::vector<float> light((size_t)width * height * 3, Config::AMBIENT_LIGHT);
+    std::vector<uint8_t> visibleTiles;
+
+    const auto& positions = map.getDecorationPositions();
+    const auto& types = map.getDecorationTypes();
+    int lightCount = 0;
+
+    for (size_t i = 0; i < positions.size(); i++) {
+        if (types[i] < 0 || types[i] >= (int)(sizeof(STATIC_LIGHTS) / sizeof(STATIC_LIGHTS[0]))) continue;
+
+        const StaticLightType& type = STATIC_LIGHTS[types[i]];
+        int lightTileX = (int)(positions[i].x / tileSize);
+        int lightTileY = (int)(positions[i].y / tileSize);
+        float centerX = (lightTileX + 0.5f) * texelsPerTile;
+        float centerY = (lightTileY + 0.5f) * texelsPerTile;
+        int reach = (int)std::ceil(type.radius);
+
+        // Occlusion is resolved per tile, then shared by that tile's texels
+        int boxMinX = std::max(0, lightTileX - reach);
+        int boxMinY = std::max(0, lightTileY - reach);
+        int boxMaxX = std::min(mapWidth - 1, lightTileX + reach);
+        int boxMaxY = std::min(mapHeight - 1, lightTileY + reach);
+        int boxWidth = boxMaxX - boxMinX + 1;
+
+        visibleTiles.assign((size_t)boxWidth * (boxMaxY - boxMinY + 1), 0);
+        for (int ty = boxMinY; ty <= boxMaxY; ty++) {
+            for (int tx = boxMinX; tx <= boxMaxX; tx++) {
+                visibleTiles[(size_t)(ty - boxMinY) * boxWidth + (tx - boxMinX)] =
+                    hasLineOfSight(map, lightTileX, lightTileY, tx, ty);
+            }
+        }
+
+        float radiusTexels = type.radius * texelsPerTile;
+        for (int y = boxMinY * texelsPerTile; y < (boxMaxY + 1) * texelsPerTile; y++) {
+            for (int x = boxMinX * texelsPerTile; x < (boxMaxX + 1) * texelsPerTile; x++) {
+                int tx = x / texelsPerTile;
+                int ty = y / texelsPerTile;
+                if (!visibleTiles[(size_t)(ty - boxMinY) * boxWidth + (tx - boxMinX)]) continue;
+
+                float dx = x + 0.5f - centerX;
+                float dy = y + 0.5f - centerY;
+                float distance = std::sqrt(dx * dx + dy * dy);
+                if (distance >= radiusTexels) continue;
+
+                float falloff = 1.0f - distance / radiusTexels;
+                float amount = type.intensity * falloff * falloff;
+
+                float* texel = &light[((size_t)y * width + x) * 3];
+                texel[0] += amount * type.r;
+                texel[1] += amount * type.g;
+                texel[2] += amount * type.b;
+            }
+        }
+
+        lightCount++;
+    }
+
+    pixels.resize((size_t)width * height);
+    for (size_t i = 0; i < pixels.size(); i++) {
+        pixels[i] = Color{
+            (unsigned char)(std::min(1.0f, light[i * 3 + 0]) * 255.0f),
+            (unsigned char)(std::min(1.0f, light[i * 3 + 1]) * 255.0f),
+            (unsigned char)(std::min(1.0f, light[i * 3 + 2]) * 255.0f),
+            255
+        };
+    }
+    return lightCount;
+}
+
+void LightingSystem::uploadLightmap(const MapGenerator& map, int lightCount) {
+    const int width = map.getMapWidth() * Config::LIGHTMAP_TEXELS_PER_TILE;
+    const int height = map.getMapHeight() * Config::LIGHTMAP_TEXELS_PER_TILE;
+
+    if (lightmap.id == 0 || lightmap.width != width || lightmap.height != height) {
+        if (lightmap.id != 0) UnloadTexture(lightmap);
+
+        Image image = GenImageColor(width, height, BLACK);
+        lightmap = LoadTextureFromImage(image);
+        UnloadImage(image);
+        SetTextureFilter(lightmap, TEXTURE_FILTER_BILINEAR);
+    }
+    UpdateTexture(lightmap, lightmapPixels.data());
+
+    bakedGeneration = map.getGeneration();
+    bakedLightCount = lightCount;
+    baked = true;
+}
+
+void LightingSystem::beginFrame() {
+    dynamicLightCount = 0;
+}
+
+void LightingSystem::addDynamicLight(Vector2 position, float radius, Color color) {
+    if (dynamicLightCount >= Config::MAX_DYNAMIC_LIGHTS) return;
+
+    dynamicLights[dynamicLightCount++] = {position, radius, color};
+}
+
+void LightingSystem::draw(const MapGenerator& map) {
+    if (!baked || bakedGeneration != map.getGeneration()) {
+        bake(map);
+    }
+
+    // Static light: one quad over the whole floor
+    float worldWidth = (float)(map.getMapWidth() * map.getTileSize());
+    float worldHeight = (float)(map.getMapHeight() * map.getTileSize());
+
+    BeginBlendMode(BLEND_MULTIPLIED);
+    DrawTexturePro(lightmap, Rectangle{0, 0, (float)lightmap.width, (float)lightmap.height},
+                   Rectangle{0, 0, worldWidth, worldHeight}, Vector2{0, 0}, 0.0f, WHITE);
+    EndBlendMode();
+
+    // Dynamic light: additive soft glows
+    if (dynamicLightCount == 0) return;
+
+    BeginBlendMode(BLEND_ADDITIVE);
+    QuadBatch::begin();
+    for (int i = 0; i < dynamicLightCount; i++) {
+        const DynamicLight& light = dynamicLights[i];
+        QuadBatch::addCircle(light.position, light.radius, light.color);
+    }
+    QuadBatch::end();
+    EndBlendMode();
+}
@@ -1,11 +1,18 @@
 #include "MapGenerator.h"
+#include "CaveGenerator.h"
+#include "UnionFind.h"
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <queue>
+#include <utility>
 
 MapGenerator::MapGenerator(int width, int height, int tSize)
-    : mapWidth(width), mapHeight(height), tileSize(tSize), rng(std::random_device{}()) {
+    : mapWidth(width), mapHeight(height), tileSize(tSize), generation(0), wallTileCount(0), fieldWidth(0), fieldHeight(0), floorSeed(0), layoutChecksum(0), rng(std::random_device{}()) {
 
     tiles.resize(mapHeight, std::vector<Tile>(mapWidth));
+    wallBits.assign(((size_t)mapWidth * mapHeight + 63) / 64, ~uint64_t(0));
     for (int y = 0; y < mapHeight; y++) {
         for (int x = 0; x < mapWidth; x++) {
             tiles[y][x] = Tile(TileType::WALL, Vector2{(float)x * tSize, (float)y * tSize}, (float)tSize);
@@ -13,7 +20,33 @@ MapGenerator::MapGenerator(int width, int height, int tSize)
     }
 }
 
-void MapGenerator::generateFloor(int floorNumber) {
+FloorStyle MapGenerator::getFloorStyle(int floorNumber) {
+    return floorNumber > 0 && floorNumber % Config::CAVE_FLOOR_INTERVAL == 0 ? FloorStyle::CAVES : FloorStyle::ROOMS;
+}
+
+void MapGenerator::generateFloor(int floorNumber, uint32_t seed, FloorStyle style) {
+    beginFloor(seed);
+
+    if (style == FloorStyle::CAVES) {
+        generateCaves();
+    } else {
+        generateRooms(floorNumber);
+    }
+
+    buildWallRects();
+    buildWallBits();
+    buildDistanceField();
+
+    std::cout << "Generated " << (style == FloorStyle::CAVES ? "cave " : "") << "floor " << floorNumber
+              << " with " << rooms.size() << " rooms, " << wallRects.size() << " wall rects for "
+              << wallTileCount << " wall tiles" << std::endl;
+}
+
+void MapGenerator::beginFloor(uint32_t seed) {
+    // Everything after this draws from rng, so the same seed rebuilds the same floor
+    rng.seed(seed);
+    floorSeed = seed;
+
     // Clear previous floor
     for (auto& row : tiles) {
         for (auto& tile : row) {
@@ -23,24 +56,36 @@ void MapGenerator::generateFloor(int floorNumber) {
     rooms.clear();
     decorativeElements.clear();
     decorativeTypes.clear();
+    generation++;
+}
 
+void MapGenerator::generateRooms(int floorNumber) {
+    std::vector<Room> regions = splitRegions(rollRoomCount(floorNumber));
+    placeRooms(regions);
+    connectRooms(regions);
+}
 
-
-    std::uniform_int_distribution<int> roomWidthDist(5, 12);
-    std::uniform_int_distribution<int> roomHeightDist(5, 10);
+int MapGenerator::rollRoomCount(int floorNumber) {
     std::uniform_int_distribution<int> numRoomsDist(8 + floorNumber, 12 + floorNumber * 2);
 
-    int numRooms = numRoomsDist(rng);
-
-    for (int i = 0; i < numRooms; i++) {
-        int w = roomWidthDist(rng);
-        int h = roomHeightDist(rng);
+    // Room counts are tuned for the standard map; larger maps get more rooms
+    // in proportion to their area
+    float areaScale = std::max(1.0f, (float)mapWidth * mapHeight / (Config::MAP_WIDTH * Config::MAP_HEIGHT));
+    return (int)(numRoomsDist(rng) * areaScale);
+}
 
-        std::uniform_int_distribution<int> xDist(1, mapWidth - w - 2);
-        std::uniform_int_distribution<int> yDist(1, mapHeight - h - 2);
+void MapGenerator::placeRooms(const std::vector<Room>& regions) {
+    std::uniform_int_distribution<int> roomWidthDist(5, 12);
+    std::uniform_int_distribution<int> roomHeightDist(5, 10);
 
-        int x = xDist(rng);
-        int y = yDist(rng);
+    // One room per region, kept a tile inside it so neighbouring rooms can
+    // never overlap or merge
+    rooms.reserve(regions.size());
+    for (const Room& region : regions) {
+        int w = std::min(roomWidthDist(rng), region.width - 2);
+        int h = std::min(roomHeightDist(rng), region.height - 2);
+        int x = region.x + 1 + std::uniform_int_distribution<int>(0, region.width - 2 - w)(rng);
+        int y = region.y + 1 + std::uniform_int_distribution<int>(0, region.height - 2 - h)(rng);
 
         carveRoom(x, y, w, h);
         rooms.push_back({x, y, w, h});
@@ -60,17 +105,153 @@ void MapGenerator::generateFloor(int floorNumber) {
 
         for (size_t i = 0; i < corners.size(); i++) {
             // Only place decoration 50% of the time
-            if (rand() % 100 < 50) {
+            if (std::uniform_int_distribution<int>(0, 99)(rng) < 50) {
                 Vector2 pos = {corners[i].x * tileSize, corners[i].y * tileSize};
                 decorativeElements.push_back(pos);
                 decorativeTypes.push_back(typeDist(rng));
             }
         }
     }
+}
 
-    connectRooms();
+void MapGenerator::generateCaves() {
+    CaveGenerator caves(mapWidth, mapHeight);
+    caves.generate(rng, Config::CAVE_SMOOTHING_STEPS);
 
-    std::cout << "Generated floor " << floorNumber << " with " << rooms.size() << " rooms" << std::endl;
+    std::uniform_real_distribution<float> decorationRoll(0.0f, 1.0f);
+    std::uniform_int_distribution<int> typeDist(0, 3);
+    for (int y = 0; y < mapHeight; y++) {
+        for (int x = 0; x < mapWidth; x++) {
+            if (caves.isWall(x, y)) continue;
+            tiles[y][x].type = TileType::FLOOR;
+
+            // Caves have no room corners; decorations go against the rock
+            bool againstWall = caves.isWall(x - 1, y) || caves.isWall(x + 1, y) ||
+                               caves.isWall(x, y - 1) || caves.isWall(x, y + 1);
+            if (againstWall && decorationRoll(rng) < Config::CAVE_DECORATION_CHANCE) {
+                decorativeElements.push_back({(float)x * tileSize, (float)y * tileSize});
+                decorativeTypes.push_back(typeDist(rng));
+            }
+        }
+    }
+
+    std::cout << "Cave layout: " << caves.getRegionCount() << " open regions, "
+              << caves.getLinkedCount() << " tunnelled to the largest" << std::endl;
+}
+
+size_t FloorSnapshot::getByteSize() const {
+    return sizeof(FloorSnapshot) + tileTypes.size() + rooms.size() * sizeof(Room) +
+           wallRects.size() * sizeof(WallRect) + wallDistance.size() * sizeof(uint16_t) +
+           spawnTiles.size() * sizeof(int) + decorationPositions.size() * sizeof(Vector2) +
+           decorationTypes.size() * sizeof(int);
+}
+
+void MapGenerator::exportFloor(FloorSnapshot& out) const {
+    out.floorSeed = floorSeed;
+    out.layoutChecksum = layoutChecksum;
+
+    out.tileTypes.resize((size_t)mapWidth * mapHeight);
+    for (int y = 0; y < mapHeight; y++) {
+        for (int x = 0; x < mapWidth; x++) {
+            out.tileTypes[(size_t)y * mapWidth + x] = (uint8_t)tiles[y][x].type;
+        }
+    }
+
+    out.wallDistance.resize(wallDistance.size());
+    for (size_t i = 0; i < wallDistance.size(); i++) {
+        float steps = std::floor(wallDistance[i] * 8.0f);
+        out.wallDistance[i] = (uint16_t)std::min(steps, 65535.0f);
+    }
+
+    out.rooms = rooms;
+    out.wallRects = wallRects;
+    out.spawnTiles = spawnTiles;
+    out.decorationPositions = decorativeElements;
+    out.decorationTypes = decorativeTypes;
+}
+
+bool MapGenerator::importFloor(const FloorSnapshot& snapshot) {
+    const int subdivisions = Config::DISTANCE_FIELD_SUBDIVISIONS;
+    size_t tileCount = (size_t)mapWidth * mapHeight;
+    if (snapshot.tileTypes.size() != tileCount ||
+        snapshot.wallDistance.size() != tileCount * subdivisions * subdivisions ||
+        snapshot.decorationPositions.size() != snapshot.decorationTypes.size()) {
+        return false;
+    }
+    for (int tile : snapshot.spawnTiles) {
+        if (tile < 0 || (size_t)tile >= tileCount) return false;
+    }
+
+    wallTileCount = 0;
+    for (int y = 0; y < mapHeight; y++) {
+        for (int x = 0; x < mapWidth; x++) {
+            uint8_t type = snapshot.tileTypes[(size_t)y * mapWidth + x];
+            tiles[y][x].type = type <= (uint8_t)TileType::TRAP ? (TileType)type : TileType::WALL;
+            if (tiles[y][x].type == TileType::WALL) wallTileCount++;
+        }
+    }
+
+    // Rebuilding the bitset is a few thousand bit sets and recomputes the
+    // checksum, which catches a snapshot that was damaged on its way back
+    buildWallBits();
+    if (layoutChecksum != snapshot.layoutChecksum) {
+        std::cerr << "Warning: cached floor failed its layout checksum" << std::endl;
+        return false;
+    }
+
+    fieldWidth = mapWidth * subdivisions;
+    fieldHeight = mapHeight * subdivisions;
+    wallDistance.resize(snapshot.wallDistance.size());
+    for (size_t i = 0; i < wallDistance.size(); i++) {
+        wallDistance[i] = snapshot.wallDistance[i] * 0.125f;
+    }
+
+    rooms = snapshot.rooms;
+    wallRects = snapshot.wallRects;
+    spawnTiles = snapshot.spawnTiles;
+    decorativeElements = snapshot.decorationPositions;
+    decorativeTypes = snapshot.decorationTypes;
+    floorSeed = snapshot.floorSeed;
+    rng.seed(floorSeed);
+    generation++;
+    return true;
+}
+
+void MapGenerator::buildWallRects() {
+    // Greedy meshing: grow each unclaimed wall tile right as far as possible,
+    // then down while the whole span below is unclaimed wall
+    wallRects.clear();
+    wallTileCount = 0;
+    std::vector<uint8_t> claimed((size_t)mapWidth * mapHeight, 0);
+
+    auto isFreeWall = [&](int x, int y) {
+        return tiles[y][x].type == TileType::WALL && !claimed[(size_t)y * mapWidth + x];
+    };
+
+    for (int y = 0; y < mapHeight; y++) {
+        for (int x = 0; x < mapWidth; x++) {
+            if (tiles[y][x].type == TileType::WALL) wallTileCount++;
+            if (!isFreeWall(x, y)) continue;
+
+            int width = 1;
+            while (x + width < mapWidth && isFreeWall(x + width, y)) width++;
+
+            int height = 1;
+            while (y + height < mapHeight) {
+                bool fullRow = true;
+                for (int dx = 0; dx < width && fullRow; dx++) {
+                    fullRow = isFreeWall(x + dx, y + height);
+                }
+                if (!fullRow) break;
+                height++;
+            }
+
+            for (int dy = 0; dy < height; dy++) {
+                std::fill_n(claimed.begin() + (size_t)(y + dy) * mapWidth + x, width, 1);
+            }
+            wallRects.push_back({x, y, width, height});
+        }
+    }
 }
 
 void MapGenerator::carveRoom(int x, int y, int w, int h) {
@@ -83,16 +264,124 @@ void MapGenerator::carveRoom(int x, int y, int w, int h) {
     }
 }
 
-void MapGenerator::connectRooms() {
-    for (size_t i = 1; i < rooms.size(); i++) {
-        int prevX = rooms[i - 1].x + rooms[i - 1].width / 2;
-        int prevY = rooms[i - 1].y + rooms[i - 1].height / 2;
+std::vector<Room> MapGenerator::splitRegions(int count) {
+    // Binary space partition of the map inside its border wall. The largest
+    // region is always split next, so regions stay evenly sized whatever the
+    // count. Regions too small to split in either direction are final.
+    const int minSize = Config::BSP_MIN_REGION_SIZE;
+    auto smaller = [](const Room& a, const Room& b) { return a.width * a.height < b.width * b.height; };
+    std::priority_queue<Room, std::vector<Room>, decltype(smaller)> open(smaller);
+    std::vector<Room> regions;
+
+    open.push({1, 1, mapWidth - 2, mapHeight - 2});
+    while (!open.empty() && (int)(regions.size() + open.size()) < count) {
+        Room region = open.top();
+        open.pop();
+
+        bool canSplitX = region.width >= 2 * minSize;
+        bool canSplitY = region.height >= 2 * minSize;
+        if (!canSplitX && !canSplitY) {
+            regions.push_back(region);
+            continue;
+        }
+
+        // Cut across the longer side; near-square regions pick at random
+        bool splitX;
+        if (!canSplitY) splitX = true;
+        else if (!canSplitX) splitX = false;
+        else if (region.width * 4 > region.height * 5) splitX = true;
+        else if (region.height * 4 > region.width * 5) splitX = false;
+        else splitX = std::uniform_int_distribution<int>(0, 1)(rng) == 0;
+
+        if (splitX) {
+            int cut = std::uniform_int_distribution<int>(minSize, region.width - minSize)(rng);
+            open.push({region.x, region.y, cut, region.height});
+            open.push({region.x + cut, region.y, region.width - cut, region.height});
+        } else {
+            int cut = std::uniform_int_distribution<int>(minSize, region.height - minSize)(rng);
+            open.push({region.x, region.y, region.width, cut});
+            open.push({region.x, region.y + cut, region.width, region.height - cut});
+        }
+    }
+
+    while (!open.empty()) {
+        regions.push_back(open.top());
+        open.pop();
+    }
+    return regions;
+}
+
+void MapGenerator::connectRooms(const std::vector<Room>& regions) {
+    // Candidate corridors join rooms whose regions share a border. The
+    // regions tile the map, so this graph is connected and planar (at most
+    // 3n edges), and found with two sorts and a binary search per region.
+    struct Corridor {
+        int from, to;
+        int lengthSquared;
+    };
+
+    const int count = (int)regions.size();
+    auto center = [this](int i) {
+        return std::make_pair(rooms[i].x + rooms[i].width / 2, rooms[i].y + rooms[i].height / 2);
+    };
+
+    std::vector<Corridor> candidates;
+    candidates.reserve((size_t)count * 3);
+
+    // Regions sorted by their left edge (then top), and by their top edge
+    // (then left). Regions that start on the same line never overlap along
+    // it, so the neighbours across one region's edge are a contiguous run.
+    std::vector<int> byLeft(count), byTop(count);
+    for (int i = 0; i < count; i++) byLeft[i] = byTop[i] = i;
+    std::sort(byLeft.begin(), byLeft.end(), [&](int a, int b) {
+        return std::make_pair(regions[a].x, regions[a].y) < std::make_pair(regions[b].x, regions[b].y);
+    });
+    std::sort(byTop.begin(), byTop.end(), [&](int a, int b) {
+        return std::make_pair(regions[a].y, regions[a].x) < std::make_pair(regions[b].y, regions[b].x);
+    });
+
+    auto addNeighbours = [&](int i, const std::vector<int>& order, bool acrossRight) {
+        const Room& region = regions[i];
+        int edge = acrossRight ? region.x + region.width : region.y + region.height;
+        int spanStart = acrossRight ? region.y : region.x;
+        int spanEnd = acrossRight ? region.y + region.height : region.x + region.width;
+        auto line = [&](int j) { return acrossRight ? regions[j].x : regions[j].y; };
+        auto start = [&](int j) { return acrossRight ? regions[j].y : regions[j].x; };
+        auto length = [&](int j) { return acrossRight ? regions[j].height : regions[j].width; };
+
+        auto it = std::lower_bound(order.begin(), order.end(), std::make_pair(edge, spanStart),
+                                   [&](int j, const std::pair<int, int>& key) {
+                                       return std::make_pair(line(j), start(j)) < key;
+                                   });
+        // The first neighbour may start above (or left of) this region
+        if (it != order.begin() && line(*(it - 1)) == edge && start(*(it - 1)) + length(*(it - 1)) > spanStart) --it;
+
+        auto [x1, y1] = center(i);
+        for (; it != order.end() && line(*it) == edge && start(*it) < spanEnd; ++it) {
+            auto [x2, y2] = center(*it);
+            candidates.push_back({i, *it, (x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1)});
+        }
+    };
 
-        int currX = rooms[i].x + rooms[i].width / 2;
-        int currY = rooms[i].y + rooms[i].height / 2;
+    for (int i = 0; i < count; i++) {
+        addNeighbours(i, byLeft, true);
+        addNeighbours(i, byTop, false);
+    }
 
-        // Make corridors wider (3 tiles instead of 1)
-        carvePath(prevX, prevY, currX, currY);
+    // Kruskal: the shortest corridors that join separate groups of rooms form
+    // the minimum spanning tree. A few of the rejected ones are carved anyway
+    // so the floor has loops instead of only dead ends.
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Corridor& a, const Corridor& b) { return a.lengthSquared < b.lengthSquared; });
+
+    UnionFind groups(count);
+    std::uniform_real_distribution<float> loopRoll(0.0f, 1.0f);
+    for (const Corridor& corridor : candidates) {
+        if (groups.unite(corridor.from, corridor.to) || loopRoll(rng) < Config::DUNGEON_LOOP_CHANCE) {
+            auto [x1, y1] = center(corridor.from);
+            auto [x2, y2] = center(corridor.to);
+            carvePath(x1, y1, x2, y2);
+        }
     }
 }
 
@@ -130,16 +419,24 @@ void MapGenerator::draw() {
     for (int y = 0; y < mapHeight; y++) {
         for (int x = 0; x < mapWidth; x++) {
             Tile& tile = tiles[y][x];
+            if (tile.type == TileType::WALL) continue;
 
-            Color color = DARKGRAY;
-            if (tile.type == TileType::FLOOR) color = Color{100, 100, 100, 255};
-            else if (tile.type == TileType::DOOR) color = ORANGE;
+            Color color = Color{100, 100, 100, 255};
+            if (tile.type == TileType::DOOR) color = ORANGE;
             else if (tile.type == TileType::TRAP) color = RED;
 
             DrawRectangle((int)tile.position.x, (int)tile.position.y, tileSize, tileSize, color);
             DrawRectangleLines((int)tile.position.x, (int)tile.position.y, tileSize, tileSize, BLACK);
         }
     }
+
+    // Walls: one fill and one outline per merged rectangle
+    for (const auto& rect : wallRects) {
+        int px = rect.x * tileSize;
+        int py = rect.y * tileSize;
+        DrawRectangle(px, py, rect.width * tileSize, rect.height * tileSize, DARKGRAY);
+        DrawRectangleLines(px, py, rect.width * tileSize, rect.height * tileSize, BLACK);
+    }
     // Draw decorations
     drawDecorations();
 }
@@ -189,8 +486,157 @@ bool MapGenerator::isWall(float x, float y) const {
     return tiles[gridY][gridX].type == TileType::WALL;
 }
 
+TileType MapGenerator::getTileType(int gridX, int gridY) const {
+    if (gridX < 0 || gridX >= mapWidth || gridY < 0 || gridY >= mapHeight) {
+        return TileType::WALL;
+    }
+
+    return tiles[gridY][gridX].type;
+}
+
+namespace {
+    // Felzenszwalb-Huttenlocher 1D squared distance transform: lower envelope
+    // of parabolas rooted at each sample, O(n). `v` and `z` are scratch space.
+    void distanceTransform1D(const float* f, int n, int stride, float* out, int* v, float* z) {
+        const float INF = 1e20f;
+        int k = 0;
+        v[0] = 0;
+        z[0] = -INF;
+        z[1] = INF;
+
+        for (int q = 1; q < n; q++) {
+            float fq = f[q * stride] + (float)q * q;
+            float s = (fq - (f[v[k] * stride] + (float)v[k] * v[k])) / (2.0f * (q - v[k]));
+            while (s <= z[k]) {
+                k--;
+                s = (fq - (f[v[k] * stride] + (float)v[k] * v[k])) / (2.0f * (q - v[k]));
+            }
+            k++;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = INF;
+        }
+
+        k = 0;
+        for (int q = 0; q < n; q++) {
+            while (z[k + 1] < q) k++;
+            float dq = (float)(q - v[k]);
+            out[q] = dq * dq + f[v[k] * stride];
+        }
+    }
+}
+
+void MapGenerator::buildDistanceField() {
+    const int subdivisions = Config::DISTANCE_FIELD_SUBDIVISIONS;
+    const float cellSize = getDistanceFieldCellSize();
+    const float INF = 1e20f;
+
+    fieldWidth = mapWidth * subdivisions;
+    fieldHeight = mapHeight * subdivisions;
+
+    std::vector<float> squared((size_t)fieldWidth * fieldHeight);
+    for (int y = 0; y < fieldHeight; y++) {
+        for (int x = 0; x < fieldWidth; x++) {
+            bool wall = tiles[y / subdivisions][x / subdivisions].type == TileType::WALL;
+            squared[(size_t)y * fieldWidth + x] = wall ? 0.0f : INF;
+        }
+    }
+
+    // Separable: columns first, then rows over the column result
+    int longest = std::max(fieldWidth, fieldHeight);
+    std::vector<float> line(longest);
+    std::vector<int> v(longest);
+    std::vector<float> z(longest + 1);
+
+    for (int x = 0; x < fieldWidth; x++) {
+        distanceTransform1D(&squared[x], fieldHeight, fieldWidth, line.data(), v.data(), z.data());
+        for (int y = 0; y < fieldHeight; y++) squared[(size_t)y * fieldWidth + x] = line[y];
+    }
+    for (int y = 0; y < fieldHeight; y++) {
+        float* row = &squared[(size_t)y * fieldWidth];
+        distanceTransform1D(row, fieldWidth, 1, line.data(), v.data(), z.data());
+        std::copy(line.begin(), line.begin() + fieldWidth, row);
+    }
+
+    wallDistance.resize(squared.size());
+    for (size_t i = 0; i < squared.size(); i++) {
+        wallDistance[i] = std::sqrt(squared[i]) * cellSize;
+    }
+
+    // Spawn candidates: floor tiles whose centre is clear of walls
+    spawnTiles.clear();
+    for (int y = 0; y < mapHeight; y++) {
+        for (int x = 0; x < mapWidth; x++) {
+            if (tiles[y][x].type == TileType::WALL) continue;
+
+            Vector2 center = {(x + 0.5f) * tileSize, (y + 0.5f) * tileSize};
+            if (getWallClearance(center) >= Config::SPAWN_MIN_WALL_CLEARANCE) {
+                spawnTiles.push_back(y * mapWidth + x);
+            }
+        }
+    }
+}
+
+float MapGenerator::getWallClearance(Vector2 worldPos) const {
+    if (wallDistance.empty()) return 0.0f;
+
+    const float cellSize = getDistanceFieldCellSize();
+    int cx = (int)std::floor(worldPos.x / cellSize);
+    int cy = (int)std::floor(worldPos.y / cellSize);
+    if (cx < 0 || cx >= fieldWidth || cy < 0 || cy >= fieldHeight) return 0.0f;
+
+    float centerDistance = wallDistance[(size_t)cy * fieldWidth + cx];
+    if (centerDistance <= 0.0f) return 0.0f;
+
+    // The field is measured between cell centres: subtract the wall cell's
+    // half diagonal and how far the point sits from its own cell centre
+    float offsetX = worldPos.x - (cx + 0.5f) * cellSize;
+    float offsetY = worldPos.y - (cy + 0.5f) * cellSize;
+    float clearance = centerDistance - cellSize * 0.70710678f - std::sqrt(offsetX * offsetX + offsetY * offsetY);
+    return std::max(0.0f, clearance);
+}
+
+Vector2 MapGenerator::getRandomSpawnPosition(Vector2 avoid, float minDistance) {
+    // Count the eligible tiles, then pick one uniformly: no rejection retries
+    float minDistanceSq = minDistance * minDistance;
+    auto farEnough = [&](int tile) {
+        float dx = (tile % mapWidth + 0.5f) * tileSize - avoid.x;
+        float dy = (tile / mapWidth + 0.5f) * tileSize - avoid.y;
+        return dx * dx + dy * dy >= minDistanceSq;
+    };
+
+    int eligible = 0;
+    for (int tile : spawnTiles) {
+        if (farEnough(tile)) eligible++;
+    }
+    if (eligible == 0) return getRandomSpawnPosition();
+
+    int pick = std::uniform_int_distribution<int>(0, eligible - 1)(rng);
+    for (int tile : spawnTiles) {
+        if (farEnough(tile) && pick-- == 0) {
+            return Vector2{(float)(tile % mapWidth) * tileSize, (float)(tile / mapWidth) * tileSize};
+        }
+    }
+    return getRandomSpawnPosition();
+}
+
+std::vector<Vector2> MapGenerator::getSpawnPositions(int count, Vector2 avoid, float minDistance) {
+    std::vector<Vector2> positions;
+
+    for (int i = 0; i < count; i++) {
+        positions.push_back(getRandomSpawnPosition(avoid, minDistance));
+    }
+
+    return positions;
+}
+
 Vector2 MapGenerator::getRandomSpawnPosition() {
-    if (rooms.empty()) return {100, 100};
+    if (rooms.empty()) {
+        // Cave floors have no rooms; any tile clear of the walls will do
+        if (spawnTiles.empty()) return {100, 100};
+        int tile = spawnTiles[std::uniform_int_distribution<size_t>(0, spawnTiles.size() - 1)(rng)];
+        return Vector2{(float)(tile % mapWidth) * tileSize, (float)(tile / mapWidth) * tileSize};
+    }
 
     std::uniform_int_distribution<size_t> roomDist(0, rooms.size() - 1);
     Room& room = rooms[roomDist(rng)];
@@ -221,3 +667,132 @@ Vector2 MapGenerator::resolveCollision(Rectangle bounds, Vector2 movement) {
 
     return movement;
 }
+
+void MapGenerator::buildWallBits() {
+    wallBits.assign(((size_t)mapWidth * mapHeight + 63) / 64, 0);
+
+    for (int y = 0; y < mapHeight; y++) {
+        for (int x = 0; x < mapWidth; x++) {
+            if (tiles[y][x].type == TileType::WALL) {
+                size_t index = (size_t)y * mapWidth + x;
+                wallBits[index >> 6] |= uint64_t(1) << (index & 63);
+            }
+        }
+    }
+
+    // FNV-1a over the wall layer; saves use it to confirm a seed rebuilt the same floor
+    uint32_t hash = 2166136261u;
+    for (uint64_t word : wallBits) {
+        for (int i = 0; i < 8; i++) {
+            hash = (hash ^ (uint32_t)((word >> (8 * i)) & 0xFF)) * 16777619u;
+        }
+    }
+    layoutChecksum = hash;
+}
+
+bool MapGenerator::raycastTiles(Vector2 from, Vector2 to, Vector2* hitPoint) const {
+    // Amanatides-Woo traversal; t runs from 0 at `from` to 1 at `to`
+    const float INF = 1e30f;
+    float dx = to.x - from.x;
+    float dy = to.y - from.y;
+
+    int tileX = (int)std::floor(from.x / tileSize);
+    int tileY = (int)std::floor(from.y / tileSize);
+    int endX = (int)std::floor(to.x / tileSize);
+    int endY = (int)std::floor(to.y / tileSize);
+
+    int stepX = dx > 0 ? 1 : (dx < 0 ? -1 : 0);
+    int stepY = dy > 0 ? 1 : (dy < 0 ? -1 : 0);
+    float tDeltaX = stepX != 0 ? tileSize / std::fabs(dx) : INF;
+    float tDeltaY = stepY != 0 ? tileSize / std::fabs(dy) : INF;
+    float tMaxX = stepX > 0 ? ((tileX + 1) * tileSize - from.x) / dx :
+                  stepX < 0 ? (tileX * tileSize - from.x) / dx : INF;
+    float tMaxY = stepY > 0 ? ((tileY + 1) * tileSize - from.y) / dy :
+                  stepY < 0 ? (tileY * tileSize - from.y) / dy : INF;
+
+    int steps = std::abs(endX - tileX) + std::abs(endY - tileY);
+    for (int i = 0; i < steps; i++) {
+        float t;
+        if (tMaxX < tMaxY) {
+            t = tMaxX;
+            tMaxX += tDeltaX;
+            tileX += stepX;
+        } else {
+            t = tMaxY;
+            tMaxY += tDeltaY;
+            tileY += stepY;
+        }
+
+        if (isWallTile(tileX, tileY)) {
+            if (hitPoint) *hitPoint = Vector2{from.x + dx * t, from.y + dy * t};
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Vector2 MapGenerator::sweepBox(Rectangle bounds, Vector2 movement) const {
+    // Sweep the box centre against each wall rectangle grown by the box's half
+    // extents (slab test). Walls the box already overlaps are ignored so a box
+    // that starts embedded can still move out.
+    float halfW = bounds.width / 2.0f;
+    float halfH = bounds.height / 2.0f;
+    float originX = bounds.x + halfW;
+    float originY = bounds.y + halfH;
+    float earliest = 1.0f;
+
+    for (const auto& rect : wallRects) {
+        float minX = rect.x * tileSize - halfW;
+        float minY = rect.y * tileSize - halfH;
+        float maxX = (rect.x + rect.width) * tileSize + halfW;
+        float maxY = (rect.y + rect.height) * tileSize + halfH;
+
+        if (originX > minX && originX < maxX && originY > minY && originY < maxY) continue;
+
+        float tEnter = 0.0f;
+        float tExit = 1.0f;
+        bool miss = false;
+
+        const float origins[2] = {originX, originY};
+        const float deltas[2] = {movement.x, movement.y};
+        const float mins[2] = {minX, minY};
+        const float maxs[2] = {maxX, maxY};
+
+        for (int axis = 0; axis < 2 && !miss; axis++) {
+            if (deltas[axis] == 0.0f) {
+                miss = origins[axis] <= mins[axis] || origins[axis] >= maxs[axis];
+                continue;
+            }
+
+            float t0 = (mins[axis] - origins[axis]) / deltas[axis];
+            float t1 = (maxs[axis] - origins[axis]) / deltas[axis];
+            if (t0 > t1) std::swap(t0, t1);
+
+            tEnter = std::max(tEnter, t0);
+            tExit = std::min(tExit, t1);
+            miss = tEnter >= tExit;
+        }
+
+        if (!miss && tEnter < earliest) earliest = tEnter;
+    }
+
+    // Stop just short of the wall so the box never ends up touching it
+    float length = std::sqrt(movement.x * movement.x + movement.y * movement.y);
+    if (earliest < 1.0f && length > 0.0f) {
+        earliest = std::max(0.0f, earliest - 0.01f / length);
+    }
+
+    return Vector2{movement.x * earliest, movement.y * earliest};
+}
+
+float MapGenerator::raycast(Vector2 from, Vector2 to) const {
+    Vector2 travelled = sweepBox(Rectangle{from.x, from.y, 0.0f, 0.0f}, Vector2{to.x - from.x, to.y - from.y});
+
+    float dx = to.x - from.x;
+    float dy = to.y - from.y;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length <= 0.0f) return 1.0f;
+
+    return std::sqrt(travelled.x * travelled.x + travelled.y * travelled.y) / length;
+}
@@ -1,87 +1,162 @@
 #include "ParticleSystem.h"
-#include <random>
+#include "QuadBatch.h"
 #include <algorithm>
 #include <cmath>
-#include "raymath.h"
-
-void ParticleSystem::addExplosion(Vector2 position, Color color, int count) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> angleDist(0, 6.28f);
-    std::uniform_real_distribution<float> speedDist(50, 150);
-    std::uniform_real_distribution<float> lifeDist(0.5f, 1.5f);
-
-    for (int i {0}; i < count; i++) {
-        float angle = angleDist(gen);
-        float speed = speedDist(gen);
-        Vector2 velocity = {cos(angle) * speed, sin(angle) * speed};
-        float life = lifeDist(gen);
-        float size = 3.0f + (rand() % 3);
-        particles.emplace_back(position, velocity, color, life, size);
+#include <random>
+
+namespace {
+    constexpr int TRIG_TABLE_SIZE = 1024;
+
+    // Unit direction vectors for TRIG_TABLE_SIZE evenly spaced angles
+    struct TrigTable {
+        float cosValues[TRIG_TABLE_SIZE];
+        float sinValues[TRIG_TABLE_SIZE];
+
+        TrigTable() {
+            for (int i = 0; i < TRIG_TABLE_SIZE; i++) {
+                float angle = (float)i * 2.0f * 3.14159265f / TRIG_TABLE_SIZE;
+                cosValues[i] = std::cos(angle);
+                sinValues[i] = std::sin(angle);
+            }
+        }
+    };
+
+    const TrigTable trigTable;
+
+    // Branch-free integration over the SoA arrays. The restrict-qualified
+    // pointers let the compiler vectorize this without alias checks.
+    void integrate(float* __restrict px, float* __restrict py, float* __restrict vx, float* __restrict vy,
+                   float* __restrict lf, float* __restrict al, const float* __restrict inv,
+                   int n, float deltaTime) {
+        const float gravity = 100.0f * deltaTime;
+
+        for (int i = 0; i < n; i++) {
+            lf[i] -= deltaTime;
+            px[i] += vx[i] * deltaTime;
+            py[i] += vy[i] * deltaTime;
+
+            // Gravity
+            vy[i] += gravity;
+
+            // Friction
+            vx[i] *= 0.98f;
+            vy[i] *= 0.98f;
+
+            // Fade out
+            float fade = lf[i] * inv[i];
+            al[i] = fade > 0.0f ? fade : 0.0f;
+        }
     }
 }
 
-void ParticleSystem::addBlood(Vector2 position, int count) {
-    for (int i = 0; i < count; i++) {
-        float angle = (rand() % 360) * 3.14f / 180.0f;
-        float speed = 30 + (rand() % 50);
-        Vector2 velocity = {cos(angle) * speed, sin(angle) * speed};
-        Color bloodColor = Color{150 + rand() % 50, 0, 0, 255};
+ParticleSystem::ParticleSystem(int maxParticles)
+    : capacity(maxParticles), count(0), rngState(std::random_device{}() | 1u) {
+    posX.resize(capacity);
+    posY.resize(capacity);
+    velX.resize(capacity);
+    velY.resize(capacity);
+    life.resize(capacity);
+    invMaxLife.resize(capacity);
+    alpha.resize(capacity);
+    size.resize(capacity);
+    colors.resize(capacity);
+}
 
-        particles.emplace_back(position, velocity, bloodColor, 1.0f, 2.0f);
-    }
+uint32_t ParticleSystem::nextRandom() {
+    // xorshift32 - plenty for visual noise and far cheaper than rand()/mt19937
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
 }
 
-void ParticleSystem::addMagic(Vector2 position, Color color, int count) {
-    for (int i = 0; i < count; i++) {
-        float angle = (rand() % 360) * 3.14f / 180.0f;
-        float speed = 20 + (rand() % 40);
-        Vector2 velocity = {cos(angle) * speed, sin(angle) * speed};
+float ParticleSystem::randomFloat(float min, float max) {
+    return min + (float)(nextRandom() >> 8) * (1.0f / 16777216.0f) * (max - min);
+}
+
+int ParticleSystem::emit(Vector2 position, Color color, int amount, float minSpeed, float maxSpeed,
+                         float minLife, float maxLife, float minSize, float maxSize) {
+    int first = count;
+    int last = std::min(capacity, count + amount); // Drop what doesn't fit
 
-        particles.emplace_back(position, velocity, color, 2.0f, 1.5f);
+    for (int i = first; i < last; i++) {
+        int angle = (int)(nextRandom() & (TRIG_TABLE_SIZE - 1));
+        float speed = randomFloat(minSpeed, maxSpeed);
+        float lifetime = randomFloat(minLife, maxLife);
+
+        posX[i] = position.x;
+        posY[i] = position.y;
+        velX[i] = trigTable.cosValues[angle] * speed;
+        velY[i] = trigTable.sinValues[angle] * speed;
+        life[i] = lifetime;
+        invMaxLife[i] = 1.0f / lifetime;
+        alpha[i] = 1.0f;
+        size[i] = randomFloat(minSize, maxSize);
+        colors[i] = color;
     }
+
+    count = last;
+    return first;
 }
 
-void ParticleSystem::addHeal(Vector2 position, int count) {
-    for (int i = 0; i < count; i++) {
-        float angle = (rand() % 360) * 3.14f / 180.0f;
-        float speed = 10 + (rand() % 30);
-        Vector2 velocity = {cos(angle) * speed, sin(angle) * speed};
+void ParticleSystem::kill(int index) {
+    int back = --count;
+    posX[index] = posX[back];
+    posY[index] = posY[back];
+    velX[index] = velX[back];
+    velY[index] = velY[back];
+    life[index] = life[back];
+    invMaxLife[index] = invMaxLife[back];
+    alpha[index] = alpha[back];
+    size[index] = size[back];
+    colors[index] = colors[back];
+}
 
-        particles.emplace_back(position, velocity, GREEN, 1.5f, 1.0f);
-    }
+void ParticleSystem::addExplosion(Vector2 position, Color color, int amount) {
+    emit(position, color, amount, 50.0f, 150.0f, 0.5f, 1.5f, 3.0f, 5.0f);
 }
 
-void ParticleSystem::update(float deltaTime) {
-    for (auto it = particles.begin(); it != particles.end();) {
-        it->life -= deltaTime;
-        it->position.x += it->velocity.x * deltaTime;
-        it->position.y += it->velocity.y * deltaTime;
+void ParticleSystem::addBlood(Vector2 position, int amount) {
+    int first = emit(position, Color{150, 0, 0, 255}, amount, 30.0f, 80.0f, 1.0f, 1.0f, 2.0f, 2.0f);
 
-        // Gravity
-        it->velocity.y += 100 * deltaTime;
+    for (int i = first; i < count; i++) {
+        colors[i].r = (unsigned char)(150 + nextRandom() % 50);
+    }
+}
+
+void ParticleSystem::addMagic(Vector2 position, Color color, int amount) {
+    emit(position, color, amount, 20.0f, 60.0f, 2.0f, 2.0f, 1.5f, 1.5f);
+}
 
-        // Friction
-        it->velocity.x *= 0.98f;
-        it->velocity.y *= 0.98f;
+void ParticleSystem::addHeal(Vector2 position, int amount) {
+    emit(position, GREEN, amount, 10.0f, 40.0f, 1.5f, 1.5f, 1.0f, 1.0f);
+}
 
-        // Fade out
-        it->color.a = (unsigned char)(255 * (it->life / it->maxLife));
+void ParticleSystem::update(float deltaTime) {
+    integrate(posX.data(), posY.data(), velX.data(), velY.data(), life.data(), alpha.data(),
+              invMaxLife.data(), count, deltaTime);
 
-        if (it->life <= 0) {
-            it = particles.erase(it);
+    for (int i = 0; i < count;) {
+        if (life[i] <= 0) {
+            kill(i); // Re-check slot i, it now holds the last particle
         } else {
-            ++it;
+            ++i;
         }
     }
 }
 
 void ParticleSystem::draw() {
-    for (const auto& particle : particles) {
-        DrawCircleV(particle.position, particle.size, particle.color);
+    if (count == 0) return;
+
+    QuadBatch::begin();
+    for (int i = 0; i < count; i++) {
+        Color color = colors[i];
+        color.a = (unsigned char)(255 * alpha[i]);
+        QuadBatch::addCircle(Vector2{posX[i], posY[i]}, size[i], color);
     }
+    QuadBatch::end();
 }
 
 void ParticleSystem::clear() {
-    particles.clear();
+    count = 0;
 }
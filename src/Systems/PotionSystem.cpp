@@ -1,37 +1,43 @@
 #include "PotionSystem.h"
+#include "PerfectHash.h"
 
-std::vector<PotionEffect> PotionSystem::potions;
-
-void PotionSystem::initialize() {
-    potions = {
+namespace {
+    // Indexed directly by PotionType - keep entries in enum order
+    constexpr PotionEffect potions[] = {
         {PotionType::HEALTH, "Health Potion", "Restores 50 HP", 75, 0, 1},
         {PotionType::SPEED, "Speed Potion", "Increases speed by 50% for 8 seconds", 0, 8000.0f, 2},
         {PotionType::STEALTH, "Stealth Potion", "Become invisible for 6 seconds", 0, 6000.0f, 2},
         {PotionType::RAGE, "Rage Potion", "Increase damage by 30% for 10 seconds", 0, 1000.0f, 2},
         {PotionType::MANA, "Mana Potion", "Restore mana", 0, 0, 3},
-        {PotionType::HEALTH, "Holy Water of Life", "Restores complete HP & curses", 500, 0, 1},
+        {PotionType::HOLY_WATER, "Holy Water of Life", "Restores complete HP & curses", 500, 0, 1},
     };
+
+    constexpr bool isIndexedByType() {
+        for (std::size_t i = 0; i < sizeof(potions) / sizeof(potions[0]); i++) {
+            if (potions[i].type != static_cast<PotionType>(i)) return false;
+        }
+        return true;
+    }
+
+    static_assert(sizeof(potions) / sizeof(potions[0]) == static_cast<std::size_t>(PotionType::COUNT),
+                  "potions must have one entry per PotionType");
+    static_assert(isIndexedByType(), "potions entries must be in PotionType order");
+
+    constexpr auto potionNameHash = buildPerfectHash<16>(potions, &PotionEffect::name);
 }
 
-PotionEffect PotionSystem::getPotionEffect(const PotionType type) {
-    for (const auto& potion : potions) if (potion.type == type) return potion;
-    return potions[0];
+const PotionEffect& PotionSystem::getPotionEffect(const PotionType type) {
+    auto index = static_cast<std::size_t>(type);
+    if (index >= static_cast<std::size_t>(PotionType::COUNT)) index = 0;
+    return potions[index];
 }
 
-PotionEffect PotionSystem::getPotionByName(const std::string& name) {
-    for (const auto& potion : potions) {
-        if (potion.name == name) {
-            return potion;
-        }
-    }
-    return potions[0];
+const PotionEffect& PotionSystem::getPotionByName(std::string_view name) {
+    std::uint8_t index = potionNameHash.find(name);
+    if (index == PerfectHash<16>::EMPTY || potions[index].name != name) return potions[0];
+    return potions[index];
 }
 
-std::string PotionSystem::getPotionDescription(PotionType type) {
-    for (const auto& potion : potions) {
-        if (potion.type == type) {
-            return potion.description;
-        }
-    }
-    return "Unknown potion";
+std::string_view PotionSystem::getPotionDescription(PotionType type) {
+    return getPotionEffect(type).description;
 }
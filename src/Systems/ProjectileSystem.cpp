@@ -0,0 +1,220 @@
+#include "ProjectileSystem.h"
+#include "MapGenerator.h"
+#include "Enemy.h"
+#include "QuadBatch.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Same restrict-qualified integration as ParticleSystem; projectiles fly
+    // straight, so it is just position and lifetime.
+    void integrate(float* __restrict px, float* __restrict py, const float* __restrict vx,
+                   const float* __restrict vy, float* __restrict lf, int n, float deltaTime) {
+        for (int i = 0; i < n; i++) {
+            px[i] += vx[i] * deltaTime;
+            py[i] += vy[i] * deltaTime;
+            lf[i] -= deltaTime;
+        }
+    }
+
+    bool circleHitsRect(float cx, float cy, float r, Rectangle rect) {
+        float nearestX = std::clamp(cx, rect.x, rect.x + rect.width);
+        float nearestY = std::clamp(cy, rect.y, rect.y + rect.height);
+        float dx = cx - nearestX;
+        float dy = cy - nearestY;
+        return dx * dx + dy * dy <= r * r;
+    }
+}
+
+ProjectileSystem::ProjectileSystem(int maxProjectiles)
+    : capacity(maxProjectiles), count(0), gridWidth(0), gridHeight(0) {
+    posX.resize(capacity);
+    posY.resize(capacity);
+    velX.resize(capacity);
+    velY.resize(capacity);
+    life.resize(capacity);
+    radius.resize(capacity);
+    damage.resize(capacity);
+    owner.resize(capacity);
+    colors.resize(capacity);
+    hits.reserve(256);
+}
+
+bool ProjectileSystem::fire(Vector2 origin, Vector2 target, float speed, int damageAmount, float projectileRadius,
+                            Color color, ProjectileOwner projectileOwner, float lifetime) {
+    if (count >= capacity) return false;
+
+    float dx = target.x - origin.x;
+    float dy = target.y - origin.y;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length < 0.001f) return false;
+
+    int i = count++;
+    posX[i] = origin.x;
+    posY[i] = origin.y;
+    velX[i] = dx / length * speed;
+    velY[i] = dy / length * speed;
+    life[i] = lifetime;
+    radius[i] = std::min(projectileRadius, Config::PROJECTILE_MAX_RADIUS);
+    damage[i] = damageAmount;
+    owner[i] = projectileOwner;
+    colors[i] = color;
+    return true;
+}
+
+void ProjectileSystem::kill(int index) {
+    int back = --count;
+    posX[index] = posX[back];
+    posY[index] = posY[back];
+    velX[index] = velX[back];
+    velY[index] = velY[back];
+    life[index] = life[back];
+    radius[index] = radius[back];
+    damage[index] = damage[back];
+    owner[index] = owner[back];
+    colors[index] = colors[back];
+}
+
+void ProjectileSystem::buildGrid(const MapGenerator& map, const std::vector<std::unique_ptr<Enemy>>& enemies) {
+    const float cellSize = (float)Config::PROJECTILE_GRID_CELL;
+    gridWidth = (map.getMapWidth() * map.getTileSize() + Config::PROJECTILE_GRID_CELL - 1) / Config::PROJECTILE_GRID_CELL;
+    gridHeight = (map.getMapHeight() * map.getTileSize() + Config::PROJECTILE_GRID_CELL - 1) / Config::PROJECTILE_GRID_CELL;
+    int cellCount = gridWidth * gridHeight;
+
+    cellStart.assign(cellCount + 1, 0);
+    enemyCells.resize(enemies.size() * 4);
+
+    // Each enemy goes in every cell its bounds overlap, grown by the largest
+    // projectile radius so a projectile only ever has to look in its own cell
+    int total = 0;
+    for (std::size_t e = 0; e < enemies.size(); e++) {
+        int* cells = &enemyCells[e * 4];
+        if (!enemies[e]->getIsAlive()) {
+            cells[0] = 0; cells[1] = 0; cells[2] = -1; cells[3] = -1;
+            continue;
+        }
+
+        Rectangle bounds = enemies[e]->getBounds();
+        cells[0] = std::clamp((int)std::floor((bounds.x - Config::PROJECTILE_MAX_RADIUS) / cellSize), 0, gridWidth - 1);
+        cells[1] = std::clamp((int)std::floor((bounds.y - Config::PROJECTILE_MAX_RADIUS) / cellSize), 0, gridHeight - 1);
+        cells[2] = std::clamp((int)std::floor((bounds.x + bounds.width + Config::PROJECTILE_MAX_RADIUS) / cellSize), 0, gridWidth - 1);
+        cells[3] = std::clamp((int)std::floor((bounds.y + bounds.height + Config::PROJECTILE_MAX_RADIUS) / cellSize), 0, gridHeight - 1);
+
+        for (int cy = cells[1]; cy <= cells[3]; cy++) {
+            for (int cx = cells[0]; cx <= cells[2]; cx++) {
+                cellStart[cy * gridWidth + cx + 1]++;
+                total++;
+            }
+        }
+    }
+
+    // Prefix sums turn the counts into start offsets. Filling advances each
+    // cell's start to its end, so shifting down by one afterwards restores them.
+    for (int c = 0; c < cellCount; c++) {
+        cellStart[c + 1] += cellStart[c];
+    }
+
+    cellItems.resize(total);
+    for (std::size_t e = 0; e < enemies.size(); e++) {
+        const int* cells = &enemyCells[e * 4];
+        for (int cy = cells[1]; cy <= cells[3]; cy++) {
+            for (int cx = cells[0]; cx <= cells[2]; cx++) {
+                cellItems[cellStart[cy * gridWidth + cx]++] = (int)e;
+            }
+        }
+    }
+
+    for (int c = cellCount; c > 0; c--) {
+        cellStart[c] = cellStart[c - 1];
+    }
+    cellStart[0] = 0;
+}
+
+int ProjectileSystem::findEnemyHit(int index, const std::vector<std::unique_ptr<Enemy>>& enemies) const {
+    int cx = (int)std::floor(posX[index] / Config::PROJECTILE_GRID_CELL);
+    int cy = (int)std::floor(posY[index] / Config::PROJECTILE_GRID_CELL);
+    if (cx < 0 || cy < 0 || cx >= gridWidth || cy >= gridHeight) return -1;
+
+    int cell = cy * gridWidth + cx;
+    for (int k = cellStart[cell]; k < cellStart[cell + 1]; k++) {
+        int e = cellItems[k];
+        if (circleHitsRect(posX[index], posY[index], radius[index], enemies[e]->getBounds())) {
+            return e;
+        }
+    }
+    return -1;
+}
+
+void ProjectileSystem::update(float deltaTime, const MapGenerator& map,
+                              const std::vector<std::unique_ptr<Enemy>>& enemies, Rectangle playerBounds) {
+    hits.clear();
+    if (count == 0) return;
+
+    integrate(posX.data(), posY.data(), velX.data(), velY.data(), life.data(), count, deltaTime);
+    buildGrid(map, enemies);
+
+    const float tileSize = (float)map.getTileSize();
+
+    for (int i = 0; i < count;) {
+        if (life[i] <= 0) {
+            kill(i); // Re-check slot i, it now holds the last projectile
+            continue;
+        }
+
+        // Sweep this step against the walls; a step that stays inside one
+        // tile can't have crossed into a wall, which is the common case
+        Vector2 to = {posX[i], posY[i]};
+        Vector2 from = {to.x - velX[i] * deltaTime, to.y - velY[i] * deltaTime};
+        if (((int)std::floor(from.x / tileSize) != (int)std::floor(to.x / tileSize) ||
+             (int)std::floor(from.y / tileSize) != (int)std::floor(to.y / tileSize)) &&
+            map.raycastTiles(from, to)) {
+            kill(i);
+            continue;
+        }
+
+        int target = -2; // -1 is the player, otherwise an enemy index
+        if (owner[i] == ProjectileOwner::PLAYER) {
+            int enemy = findEnemyHit(i, enemies);
+            if (enemy >= 0) target = enemy;
+        } else if (circleHitsRect(to.x, to.y, radius[i], playerBounds)) {
+            target = -1;
+        }
+
+        if (target != -2) {
+            hits.push_back(ProjectileHit{to, target, damage[i], colors[i]});
+            kill(i);
+            continue;
+        }
+
+        ++i;
+    }
+}
+
+void ProjectileSystem::draw(Rectangle view) const {
+    if (count == 0) return;
+
+    const float margin = Config::PROJECTILE_MAX_RADIUS * 2;
+    float minX = view.x - margin;
+    float minY = view.y - margin;
+    float maxX = view.x + view.width + margin;
+    float maxY = view.y + view.height + margin;
+
+    QuadBatch::begin();
+    for (int i = 0; i < count; i++) {
+        if (posX[i] < minX || posX[i] > maxX || posY[i] < minY || posY[i] > maxY) continue;
+
+        Vector2 head = {posX[i], posY[i]};
+        Vector2 tail = {head.x - velX[i] * 0.03f, head.y - velY[i] * 0.03f};
+        Color trail = colors[i];
+        trail.a = 90;
+
+        QuadBatch::addLine(tail, head, radius[i], trail);
+        QuadBatch::addCircle(head, radius[i], colors[i]);
+    }
+    QuadBatch::end();
+}
+
+void ProjectileSystem::clear() {
+    count = 0;
+    hits.clear();
+}
@@ -0,0 +1,163 @@
+#include "QuadBatch.h"
+#include "rlgl.h"
+#include <cmath>
+#include <iostream>
+
+namespace {
+    constexpr int SPRITE_SIZE = 32;
+    constexpr int RING_SEGMENTS = 32;
+
+    // Texel in the middle of the disc, fully opaque - used for solid lines
+    constexpr float SOLID_U = 0.5f;
+    constexpr float SOLID_V = 0.5f;
+
+    struct RingTable {
+        float cosValues[RING_SEGMENTS + 1];
+        float sinValues[RING_SEGMENTS + 1];
+
+        RingTable() {
+            for (int i = 0; i <= RING_SEGMENTS; i++) {
+                float angle = (float)i * 2.0f * 3.14159265f / RING_SEGMENTS;
+                cosValues[i] = std::cos(angle);
+                sinValues[i] = std::sin(angle);
+            }
+        }
+    };
+
+    const RingTable ringTable;
+}
+
+Texture2D QuadBatch::softCircle = {};
+bool QuadBatch::ready = false;
+bool QuadBatch::drawing = false;
+int QuadBatch::frameVertices = 0;
+int QuadBatch::frameBatches = 0;
+
+void QuadBatch::initialize() {
+    if (ready) shutdown();
+
+    // White disc with a one-texel soft edge; the tint supplies the colour
+    static Color pixels[SPRITE_SIZE * SPRITE_SIZE];
+    const float half = SPRITE_SIZE / 2.0f;
+    for (int y = 0; y < SPRITE_SIZE; y++) {
+        for (int x = 0; x < SPRITE_SIZE; x++) {
+            float dx = (x + 0.5f - half) / half;
+            float dy = (y + 0.5f - half) / half;
+            float edge = (1.0f - std::sqrt(dx * dx + dy * dy)) * half;
+            float alpha = edge < 0.0f ? 0.0f : (edge > 1.0f ? 1.0f : edge);
+            pixels[y * SPRITE_SIZE + x] = Color{255, 255, 255, (unsigned char)(255 * alpha)};
+        }
+    }
+
+    Image image = {pixels, SPRITE_SIZE, SPRITE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+    softCircle = LoadTextureFromImage(image);
+
+    if (softCircle.id == 0) {
+        std::cout << "Warning: Could not create quad batch texture, using shape drawing" << std::endl;
+        return;
+    }
+
+    SetTextureFilter(softCircle, TEXTURE_FILTER_BILINEAR);
+    ready = true;
+}
+
+void QuadBatch::shutdown() {
+    if (softCircle.id != 0) {
+        UnloadTexture(softCircle);
+    }
+    softCircle = {};
+    ready = false;
+}
+
+void QuadBatch::beginFrame() {
+    frameVertices = 0;
+    frameBatches = 0;
+}
+
+void QuadBatch::begin() {
+    if (!ready || drawing) return;
+
+    // Switching texture starts a new draw call in the rlgl batch
+    rlSetTexture(softCircle.id);
+    rlBegin(RL_QUADS);
+    drawing = true;
+    frameBatches++;
+}
+
+void QuadBatch::end() {
+    if (!drawing) return;
+
+    rlEnd();
+    rlSetTexture(0);
+    drawing = false;
+}
+
+void QuadBatch::pushQuad(Vector2 a, Vector2 b, Vector2 c, Vector2 d,
+                         float u0, float v0, float u1, float v1, Color color) {
+    // rlgl flushes and restores our texture/mode if the vertex buffer is full
+    if (rlCheckRenderBatchLimit(4)) frameBatches++;
+
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    rlTexCoord2f(u0, v0); rlVertex2f(a.x, a.y);
+    rlTexCoord2f(u0, v1); rlVertex2f(b.x, b.y);
+    rlTexCoord2f(u1, v1); rlVertex2f(c.x, c.y);
+    rlTexCoord2f(u1, v0); rlVertex2f(d.x, d.y);
+
+    frameVertices += 4;
+}
+
+void QuadBatch::addCircle(Vector2 center, float radius, Color color) {
+    if (!drawing) {
+        DrawCircleV(center, radius, color);
+        return;
+    }
+
+    float left = center.x - radius;
+    float right = center.x + radius;
+    float top = center.y - radius;
+    float bottom = center.y + radius;
+
+    pushQuad({left, top}, {left, bottom}, {right, bottom}, {right, top}, 0.0f, 0.0f, 1.0f, 1.0f, color);
+}
+
+void QuadBatch::addLine(Vector2 from, Vector2 to, float thickness, Color color) {
+    if (!drawing) {
+        DrawLineEx(from, to, thickness, color);
+        return;
+    }
+
+    float dx = to.x - from.x;
+    float dy = to.y - from.y;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length < 0.0001f) return;
+
+    // Offset both ends by half the thickness along the normal, keeping the
+    // same winding as raylib's own quads so face culling doesn't drop them
+    float nx = dy / length * thickness * 0.5f;
+    float ny = -dx / length * thickness * 0.5f;
+
+    pushQuad({from.x + nx, from.y + ny}, {from.x - nx, from.y - ny},
+             {to.x - nx, to.y - ny}, {to.x + nx, to.y + ny},
+             SOLID_U, SOLID_V, SOLID_U, SOLID_V, color);
+}
+
+void QuadBatch::addRing(Vector2 center, float radius, float thickness, Color color) {
+    if (!drawing) {
+        DrawCircleLines((int)center.x, (int)center.y, radius, color);
+        return;
+    }
+
+    float inner = radius - thickness * 0.5f;
+    float outer = radius + thickness * 0.5f;
+
+    for (int i = 0; i < RING_SEGMENTS; i++) {
+        float c0 = ringTable.cosValues[i], s0 = ringTable.sinValues[i];
+        float c1 = ringTable.cosValues[i + 1], s1 = ringTable.sinValues[i + 1];
+
+        pushQuad({center.x + c0 * outer, center.y + s0 * outer},
+                 {center.x + c0 * inner, center.y + s0 * inner},
+                 {center.x + c1 * inner, center.y + s1 * inner},
+                 {center.x + c1 * outer, center.y + s1 * outer},
+                 SOLID_U, SOLID_V, SOLID_U, SOLID_V, color);
+    }
+}
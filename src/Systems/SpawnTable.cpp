@@ -0,0 +1,195 @@
+#include "SpawnTable.h"
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+
+namespace {
+    struct SpawnUnlock {
+        int minLevel;
+        EnemyType type;
+    };
+
+    struct BossChance {
+        int minLevel;
+        EnemyType type;
+        float chance; // Rolled in order, before the regular pool
+    };
+
+    constexpr SpawnUnlock unlocks[] = {
+        // Tier D (Always available)
+        {1, EnemyType::GOBLIN}, {1, EnemyType::SKELETON}, {1, EnemyType::SLIME},
+        {5, EnemyType::BAT}, {5, EnemyType::FIRE_SPIRIT}, {5, EnemyType::DARK_SPIRIT}, {5, EnemyType::LIGHT_SPIRIT},
+        {8, EnemyType::HOUND}, {8, EnemyType::SALAMANDER_MAN},
+
+        // Tier C (Level 10+)
+        {10, EnemyType::CHIMERA_ANT}, {10, EnemyType::WEREWOLF}, {10, EnemyType::CERBERUS}, {10, EnemyType::HONEY_BEE},
+        {12, EnemyType::CYCLOPS}, {12, EnemyType::MINOTAUR}, {12, EnemyType::STONE_GOLEM}, {12, EnemyType::ANCIENT_MUMMY},
+
+        // Tier B
+        {15, EnemyType::IMP}, {15, EnemyType::ELF_GIRL}, {15, EnemyType::SKELETON_KNIGHT}, {15, EnemyType::WITCH},
+        {18, EnemyType::MAGE}, {18, EnemyType::GOBLIN_GIANT}, {18, EnemyType::LAVA_GOLEM},
+    };
+
+    constexpr BossChance bosses[] = {
+        {15, EnemyType::FALLEN_SHADOW_PALADIN, 0.05f},
+        {20, EnemyType::HARPY_QUEEN, 0.05f},
+        {25, EnemyType::NECROMANCER, 0.05f},
+    };
+
+    // Band boundaries are every level at which the pool changes
+    constexpr int bandLevels[] = {1, 5, 8, 10, 12, 15, 18, 20, 25};
+
+    struct EnemyName {
+        const char* name;
+        EnemyType type;
+    };
+
+    constexpr EnemyName enemyNames[] = {
+        {"GOBLIN", EnemyType::GOBLIN}, {"SKELETON", EnemyType::SKELETON}, {"SLIME", EnemyType::SLIME},
+        {"HOUND", EnemyType::HOUND}, {"BAT", EnemyType::BAT}, {"FIRE_SPIRIT", EnemyType::FIRE_SPIRIT},
+        {"DARK_SPIRIT", EnemyType::DARK_SPIRIT}, {"LIGHT_SPIRIT", EnemyType::LIGHT_SPIRIT},
+        {"CHIMERA_ANT", EnemyType::CHIMERA_ANT}, {"WEREWOLF", EnemyType::WEREWOLF}, {"CERBERUS", EnemyType::CERBERUS},
+        {"CYCLOPS", EnemyType::CYCLOPS}, {"MINOTAUR", EnemyType::MINOTAUR}, {"STONE_GOLEM", EnemyType::STONE_GOLEM},
+        {"SALAMANDER_MAN", EnemyType::SALAMANDER_MAN}, {"HONEY_BEE", EnemyType::HONEY_BEE},
+        {"SKELETON_KNIGHT", EnemyType::SKELETON_KNIGHT}, {"ELF_GIRL", EnemyType::ELF_GIRL},
+        {"GOBLIN_GIANT", EnemyType::GOBLIN_GIANT}, {"MAGE", EnemyType::MAGE}, {"LAVA_GOLEM", EnemyType::LAVA_GOLEM},
+        {"IMP", EnemyType::IMP}, {"ANCIENT_MUMMY", EnemyType::ANCIENT_MUMMY}, {"WITCH", EnemyType::WITCH},
+        {"FALLEN_SHADOW_PALADIN", EnemyType::FALLEN_SHADOW_PALADIN}, {"HARPY_QUEEN", EnemyType::HARPY_QUEEN},
+        {"NECROMANCER", EnemyType::NECROMANCER},
+    };
+
+    bool parseEnemyType(const std::string& name, EnemyType& out) {
+        for (const auto& entry : enemyNames) {
+            if (name == entry.name) {
+                out = entry.type;
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+SpawnTable::SpawnTable() : builtFloor(0) {}
+
+bool SpawnTable::loadFloorWeights(const std::string& filename) {
+    overrides.clear();
+
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cout << "No spawn weights file found, using default weights" << std::endl;
+        return false;
+    }
+
+    int firstFloor = 1;
+    int lastFloor = 1 << 30;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        lineNumber++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+
+        std::istringstream stream(line);
+        std::string key;
+        if (!(stream >> key)) continue;
+
+        if (key == "floor") {
+            // "floor 3" or "floor 3 7" - applies to the lines that follow
+            if (!(stream >> firstFloor)) {
+                std::cerr << filename << ":" << lineNumber << ": expected floor number" << std::endl;
+                continue;
+            }
+            if (!(stream >> lastFloor)) lastFloor = firstFloor;
+            continue;
+        }
+
+        EnemyType type;
+        float multiplier;
+        if (!parseEnemyType(key, type) || !(stream >> multiplier) || multiplier < 0.0f) {
+            std::cerr << filename << ":" << lineNumber << ": invalid spawn weight '" << key << "'" << std::endl;
+            continue;
+        }
+
+        overrides.push_back({firstFloor, lastFloor, type, multiplier});
+    }
+
+    std::cout << "Loaded " << overrides.size() << " spawn weight overrides" << std::endl;
+    builtFloor = 0;
+    return true;
+}
+
+float SpawnTable::getFloorMultiplier(EnemyType type, int floorNumber) const {
+    float multiplier = 1.0f;
+    // Later lines win, so the file can go from general to specific
+    for (const auto& entry : overrides) {
+        if (entry.type == type && floorNumber >= entry.firstFloor && floorNumber <= entry.lastFloor) {
+            multiplier = entry.multiplier;
+        }
+    }
+    return multiplier;
+}
+
+void SpawnTable::buildForFloor(int floorNumber) {
+    if (floorNumber == builtFloor && !bands.empty()) return;
+
+    bands.clear();
+    for (int level : bandLevels) {
+        SpawnBand band;
+        band.minLevel = level;
+
+        // Bosses are rolled in order before the regular pool, so each one only
+        // gets its chance of whatever probability the earlier rolls left over.
+        float remaining = 1.0f;
+        for (const auto& boss : bosses) {
+            if (level < boss.minLevel) continue;
+            float weight = remaining * boss.chance;
+            remaining -= weight;
+            band.types.push_back(boss.type);
+            band.cumulative.push_back(weight * getFloorMultiplier(boss.type, floorNumber));
+        }
+
+        int regularCount = 0;
+        for (const auto& unlock : unlocks) {
+            if (level >= unlock.minLevel) regularCount++;
+        }
+
+        for (const auto& unlock : unlocks) {
+            if (level < unlock.minLevel) continue;
+            band.types.push_back(unlock.type);
+            band.cumulative.push_back(remaining / regularCount * getFloorMultiplier(unlock.type, floorNumber));
+        }
+
+        for (size_t i = 1; i < band.cumulative.size(); i++) {
+            band.cumulative[i] += band.cumulative[i - 1];
+        }
+
+        bands.push_back(std::move(band));
+    }
+
+    builtFloor = floorNumber;
+}
+
+EnemyType SpawnTable::sample(int playerLevel, std::mt19937& rng) const {
+    if (bands.empty()) return EnemyType::GOBLIN;
+
+    // Highest band the player has reached
+    auto bandIt = std::upper_bound(bands.begin(), bands.end(), playerLevel,
+                                   [](int level, const SpawnBand& band) { return level < band.minLevel; });
+    const SpawnBand& band = bandIt == bands.begin() ? bands.front() : *(bandIt - 1);
+
+    float total = band.cumulative.empty() ? 0.0f : band.cumulative.back();
+    if (total <= 0.0f) return EnemyType::GOBLIN;
+
+    std::uniform_real_distribution<float> roll(0.0f, total);
+    auto it = std::upper_bound(band.cumulative.begin(), band.cumulative.end(), roll(rng));
+    if (it == band.cumulative.end()) {
+        // Float rounding can roll exactly `total`. Fall back to the last type
+        // with a non-zero weight, never one the config disabled.
+        --it;
+        while (it != band.cumulative.begin() && *it <= *(it - 1)) --it;
+    }
+
+    return band.types[it - band.cumulative.begin()];
+}
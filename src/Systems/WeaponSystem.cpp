@@ -1,36 +1,52 @@
 #include "WeaponSystem.h"
+#include "PerfectHash.h"
 
-std::vector<WeaponStats> WeaponSystem::weapons;
-
-void WeaponSystem::initialize() {
-    weapons = {
-        {"Valyrian Sword", 10, 1.0f, 0.0f, "Basic starter weapon", 1},
-        {"Iron Katana", 18, 1.2f, 0.05f, "Fast and sharp", 5},
-        {"Steel Dagger", 12, 1.5f, 0.10f, "Fastest weapon with crit bonus", 10},
-        {"Shuriken", 15, 0.8f, 0.0f, "Ranged throwing weapon", 15},
-        {"Shadow Ball", 22, 0.7f, 0.0f, "Magical attack", 20}
+namespace {
+    // Indexed directly by WeaponType - keep entries in enum order
+    constexpr WeaponStats weapons[] = {
+        {WeaponType::WOODEN_SWORD, "Valyrian Sword", 10, 1.0f, 0.0f, "Basic starter weapon", 1},
+        {WeaponType::IRON_KATANA, "Iron Katana", 18, 1.2f, 0.05f, "Fast and sharp", 5},
+        {WeaponType::STEEL_DAGGER, "Steel Dagger", 12, 1.5f, 0.10f, "Fastest weapon with crit bonus", 10},
+        {WeaponType::SHURIKEN, "Shuriken", 15, 0.8f, 0.0f, "Ranged throwing weapon", 15},
+        {WeaponType::SHADOW_BALL, "Shadow Ball", 22, 0.7f, 0.0f, "Magical attack", 20}
     };
-}
 
-WeaponStats WeaponSystem::getWeaponStats(const std::string& weaponName) {
-    for (const auto& weapon : weapons) {
-        if (weapon.name == weaponName) {
-            return weapon;
+    constexpr bool isIndexedByType() {
+        for (std::size_t i = 0; i < sizeof(weapons) / sizeof(weapons[0]); i++) {
+            if (weapons[i].type != static_cast<WeaponType>(i)) return false;
         }
+        return true;
     }
-    return weapons[0]; // Return wooden sword as default
-}
 
-std::string WeaponSystem::getWeaponDescription(const std::string& weaponName) {
-    for (const auto& weapon : weapons) {
-        if (weapon.name == weaponName) {
-            return weapon.description;
-        }
+    static_assert(sizeof(weapons) / sizeof(weapons[0]) == static_cast<std::size_t>(WeaponType::COUNT),
+                  "weapons must have one entry per WeaponType");
+    static_assert(isIndexedByType(), "weapons entries must be in WeaponType order");
+
+    constexpr auto weaponNameHash = buildPerfectHash<16>(weapons, &WeaponStats::name);
+
+    const WeaponStats* findWeapon(std::string_view weaponName) {
+        std::uint8_t index = weaponNameHash.find(weaponName);
+        if (index == PerfectHash<16>::EMPTY || weapons[index].name != weaponName) return nullptr;
+        return &weapons[index];
     }
-    return "Unknown weapon";
 }
 
-int WeaponSystem::getWeaponDamage(const std::string& weaponName, int basePlayerDamage) {
-    WeaponStats stats = getWeaponStats(weaponName);
-    return basePlayerDamage + stats.baseDamage;
+const WeaponStats& WeaponSystem::getWeaponStats(WeaponType type) {
+    auto index = static_cast<std::size_t>(type);
+    if (index >= static_cast<std::size_t>(WeaponType::COUNT)) index = 0;
+    return weapons[index];
+}
+
+const WeaponStats& WeaponSystem::getWeaponStats(std::string_view weaponName) {
+    const WeaponStats* weapon = findWeapon(weaponName);
+    return weapon ? *weapon : weapons[0]; // Return wooden sword as default
+}
+
+std::string_view WeaponSystem::getWeaponDescription(std::string_view weaponName) {
+    const WeaponStats* weapon = findWeapon(weaponName);
+    return weapon ? weapon->description : "Unknown weapon";
+}
+
+int WeaponSystem::getWeaponDamage(std::string_view weaponName, int basePlayerDamage) {
+    return basePlayerDamage + getWeaponStats(weaponName).baseDamage;
 }
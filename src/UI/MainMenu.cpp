@@ -1,18 +1,52 @@
 #include "MainMenu.h"
 #include "SaveSystem.h"
+#include "Config.h"
 #include <iostream>
+#include <algorithm>
 #include <ctime>
 
 MainMenu::MainMenu()
     : currentState(MenuState::MAIN_MENU),
       selectedOption(0),
+      selectedSave(0),
+      selectedSlot(0),
+      overwriteRow(-1),
       masterVolume(0.7f),
       musicVolume(0.5f),
       graphicsQuality(2),
       enableParticles(true),
       playerName(""),
       inputtingName(false) {
-    saveExists = SaveSystem::saveExists("saves/savegame.json");
+    refreshSaves();
+}
+
+void MainMenu::refreshSaves() {
+    saves = SaveSystem::getAllSaves();
+    saveExists = !saves.empty();
+    selectedSave = std::clamp(selectedSave, 0, std::max(0, (int)saves.size() - 1));
+}
+
+void MainMenu::beginNewGame() {
+    currentState = MenuState::NEW_GAME;
+    inputtingName = true;
+    playerName = "";
+
+    std::vector<bool> used(Config::MAX_SAVE_SLOTS, false);
+    for (const auto& save : saves) {
+        if (save.slot >= 0 && save.slot < Config::MAX_SAVE_SLOTS) used[save.slot] = true;
+    }
+    for (int slot = 0; slot < Config::MAX_SAVE_SLOTS; slot++) {
+        if (!used[slot]) {
+            selectedSlot = slot;
+            overwriteRow = -1;
+            return;
+        }
+    }
+
+    // Every slot is taken; saves are sorted newest first, so offer the
+    // oldest, which the confirmation screen names before it is replaced
+    overwriteRow = (int)saves.size() - 1;
+    selectedSlot = saves[overwriteRow].slot;
 }
 
 MenuState MainMenu::update() {
@@ -54,12 +88,11 @@ MenuState MainMenu::updateMainMenu() {
         if (saveExists) {
             // With save: NEW, RESUME, SETTINGS, QUIT
             if (selectedOption == 0) {
-                currentState = MenuState::NEW_GAME;
-                inputtingName = true;
-                playerName = "";
+                beginNewGame();
             }
             else if (selectedOption == 1) {
                 currentState = MenuState::LOAD_GAME;
+                selectedSave = 0;
             }
             else if (selectedOption == 2) {
                 currentState = MenuState::SETTINGS;
@@ -71,9 +104,7 @@ MenuState MainMenu::updateMainMenu() {
         } else {
             // Without save: NEW, SETTINGS, QUIT
             if (selectedOption == 0) {
-                currentState = MenuState::NEW_GAME;
-                inputtingName = true;
-                playerName = "";
+                beginNewGame();
             }
             else if (selectedOption == 1) {
                 currentState = MenuState::SETTINGS;
@@ -90,7 +121,8 @@ MenuState MainMenu::updateMainMenu() {
 
 MenuState MainMenu::updateNewGame() {
     if (!inputtingName) {
-        // Name already entered, show confirmation
+        // Name already entered, show confirmation. With every slot taken this
+        // is also where the player agrees to replace the oldest save.
         if (IsKeyPressed(KEY_ENTER)) {
             return MenuState::PLAYING;
         }
@@ -130,10 +162,26 @@ MenuState MainMenu::updateNewGame() {
 }
 
 MenuState MainMenu::updateLoadGame() {
+    if (saves.empty()) {
+        currentState = MenuState::MAIN_MENU;
+        selectedOption = 0;
+        return currentState;
+    }
+
+    if (IsKeyPressed(KEY_UP)) selectedSave = (selectedSave + (int)saves.size() - 1) % (int)saves.size();
+    if (IsKeyPressed(KEY_DOWN)) selectedSave = (selectedSave + 1) % (int)saves.size();
+
     if (IsKeyPressed(KEY_ENTER)) {
+        selectedSlot = saves[selectedSave].slot;
         return MenuState::PLAYING;
     }
 
+    if (IsKeyPressed(KEY_DELETE)) {
+        SaveSystem::deleteSave(saves[selectedSave].slot);
+        refreshSaves();
+        return currentState;
+    }
+
     if (IsKeyPressed(KEY_ESCAPE)) {
         currentState = MenuState::MAIN_MENU;
         selectedOption = 0;
@@ -262,6 +310,26 @@ void MainMenu::drawNewGame() {
         // Instructions
         DrawText("Type your name and press ENTER | BACKSPACE to delete | ESC to go back",
                 50, screenHeight - 60, 14, YELLOW);
+    } else if (overwriteRow >= 0 && overwriteRow < (int)saves.size()) {
+        // Every slot is taken: name the save that would be lost
+        const SaveSummary& save = saves[overwriteRow];
+
+        std::string text = "ALL SAVE SLOTS ARE FULL";
+        int textWidth = MeasureText(text.c_str(), 40);
+        DrawText(text.c_str(), (screenWidth - textWidth) / 2, screenHeight / 2 - 110, 40, ORANGE);
+
+        std::string slotText = TextFormat("Starting will overwrite slot %d: %s, Lv %d, Floor %d", save.slot + 1,
+                                          save.playerName.empty() ? "Hero" : save.playerName.c_str(),
+                                          save.level, save.floor);
+        int slotTextWidth = MeasureText(slotText.c_str(), 24);
+        DrawText(slotText.c_str(), (screenWidth - slotTextWidth) / 2, screenHeight / 2 - 30, 24, WHITE);
+
+        std::string playerText = "New player: " + playerName;
+        int playerTextWidth = MeasureText(playerText.c_str(), 24);
+        DrawText(playerText.c_str(), (screenWidth - playerTextWidth) / 2, screenHeight / 2 + 40, 24, WHITE);
+
+        DrawText("ENTER: Overwrite and start | ESC: Back (delete a save from Resume to free a slot)",
+                 50, screenHeight - 60, 14, YELLOW);
     } else {
         // Confirmation screen
         std::string text = "STARTING NEW GAME...";
@@ -286,18 +354,43 @@ void MainMenu::drawLoadGame() {
     int titleWidth = MeasureText(title.c_str(), 48);
     DrawText(title.c_str(), (screenWidth - titleWidth) / 2, 100, 48, SKYBLUE);
 
-    std::string loading = "Loading your adventure...";
-    int loadingWidth = MeasureText(loading.c_str(), 24);
-    DrawText(loading.c_str(), (screenWidth - loadingWidth) / 2, screenHeight / 2 - 50, 24, WHITE);
+    // Scrolling window over the slot list, keeping the selection visible
+    const int rowHeight = 44;
+    const int listTop = 190;
+    int visibleRows = std::max(1, (screenHeight - listTop - 100) / rowHeight);
+    int firstRow = std::clamp(selectedSave - visibleRows / 2, 0, std::max(0, (int)saves.size() - visibleRows));
+    int lastRow = std::min((int)saves.size(), firstRow + visibleRows);
+
+    int listX = screenWidth / 2 - 420;
+    for (int row = firstRow; row < lastRow; row++) {
+        const SaveSummary& save = saves[row];
+        bool selected = row == selectedSave;
+        int y = listTop + (row - firstRow) * rowHeight;
+
+        if (selected) {
+            DrawRectangle(listX - 10, y - 6, 860, rowHeight - 4, Color{40, 60, 80, 255});
+        }
+
+        int seconds = (int)save.playTime;
+        char savedAt[32] = "--";
+        std::time_t time = (std::time_t)save.savedAt;
+        if (save.savedAt > 0) {
+            std::strftime(savedAt, sizeof(savedAt), "%Y-%m-%d %H:%M", std::localtime(&time));
+        }
+
+        Color color = selected ? LIME : WHITE;
+        DrawText(TextFormat("%s%s", selected ? "> " : "  ", save.playerName.empty() ? "Hero" : save.playerName.c_str()),
+                 listX, y, 24, color);
+        DrawText(TextFormat("Lv %d", save.level), listX + 330, y, 24, color);
+        DrawText(TextFormat("Floor %d", save.floor), listX + 430, y, 24, color);
+        DrawText(TextFormat("%d:%02d:%02d", seconds / 3600, seconds / 60 % 60, seconds % 60), listX + 570, y, 24, GRAY);
+        DrawText(savedAt, listX + 690, y + 6, 14, GRAY);
+    }
 
-    // Loading animation
-    int dots = ((int)(GetTime() * 2)) % 4;
-    std::string dotStr = "";
-    for (int i = 0; i < dots; i++) dotStr += ".";
-    int dotsWidth = MeasureText(dotStr.c_str(), 24);
-    DrawText(dotStr.c_str(), (screenWidth - dotsWidth) / 2, screenHeight / 2 + 50, 24, GRAY);
+    if (firstRow > 0) DrawText("...", screenWidth / 2 - 10, listTop - 24, 20, GRAY);
+    if (lastRow < (int)saves.size()) DrawText("...", screenWidth / 2 - 10, listTop + visibleRows * rowHeight - 10, 20, GRAY);
 
-    DrawText("Press ENTER to continue | ESC to go back", 50, screenHeight - 60, 14, YELLOW);
+    DrawText("UP/DOWN: Select | ENTER: Load | DELETE: Delete save | ESC: Back", 50, screenHeight - 60, 14, YELLOW);
 }
 
 void MainMenu::drawSettings() {
@@ -0,0 +1,149 @@
+#include "MiniMap.h"
+#include "Game.h"
+#include "Player.h"
+#include "MapGenerator.h"
+#include "FieldOfView.h"
+#include "QuadBatch.h"
+#include "Config.h"
+
+namespace {
+    const Color UNEXPLORED_COLOR = Color{25, 25, 25, 255};
+    const Color WALL_COLOR = Color{128, 128, 128, 255};
+}
+
+MiniMap::MiniMap(int width, int height)
+    : width(width), height(height), tileLayer({}), exploredMask({}), maskExploredVersion(0),
+      builtGeneration(0), built(false) {}
+
+MiniMap::~MiniMap() {
+    unload();
+}
+
+void MiniMap::unload() {
+    if (tileLayer.id != 0) {
+        UnloadRenderTexture(tileLayer);
+        tileLayer = {};
+    }
+    if (exploredMask.id != 0) {
+        UnloadTexture(exploredMask);
+        exploredMask = {};
+    }
+    built = false;
+}
+
+void MiniMap::rebuild(const MapGenerator& map) {
+    int mapWidth = map.getMapWidth();
+    int mapHeight = map.getMapHeight();
+
+    if (tileLayer.id == 0) {
+        tileLayer = LoadRenderTexture(width, height);
+    }
+
+    // Static tile layer, drawn once for the whole floor. Floors stay
+    // transparent so the panel background shows through.
+    float cellSize = (float)width / mapWidth; // Square cells, like the world view
+
+    BeginTextureMode(tileLayer);
+    ClearBackground(BLANK);
+    for (int y = 0; y < mapHeight; y++) {
+        for (int x = 0; x < mapWidth; x++) {
+            if (map.getTileType(x, y) == TileType::WALL) {
+                DrawRectangleRec(Rectangle{x * cellSize, y * cellSize, cellSize, cellSize}, WALL_COLOR);
+            }
+        }
+    }
+    EndTextureMode();
+
+    // Explored mask starts fully covered
+    maskPixels.assign((size_t)mapWidth * mapHeight, UNEXPLORED_COLOR);
+
+    if (exploredMask.id == 0 || exploredMask.width != mapWidth || exploredMask.height != mapHeight) {
+        if (exploredMask.id != 0) UnloadTexture(exploredMask);
+
+        Image image = GenImageColor(mapWidth, mapHeight, UNEXPLORED_COLOR);
+        exploredMask = LoadTextureFromImage(image);
+        UnloadImage(image);
+    }
+    maskExploredVersion = 0;
+
+    builtGeneration = map.getGeneration();
+    built = true;
+}
+
+void MiniMap::updateMask(const FieldOfView& fov, int mapWidth, int mapHeight) {
+    if (fov.getExploredVersion() == maskExploredVersion) return;
+
+    bool changed = false;
+    for (int y = 0; y < mapHeight; y++) {
+        for (int x = 0; x < mapWidth; x++) {
+            Color& texel = maskPixels[(size_t)y * mapWidth + x];
+            Color wanted = fov.isExplored(x, y) ? BLANK : UNEXPLORED_COLOR;
+            if (texel.a != wanted.a) {
+                texel = wanted;
+                changed = true;
+            }
+        }
+    }
+
+    if (changed && exploredMask.id != 0) {
+        UpdateTexture(exploredMask, maskPixels.data());
+    }
+    maskExploredVersion = fov.getExploredVersion();
+}
+
+void MiniMap::draw(Game* game, int x, int y) {
+    if (!game) return;
+
+    MapGenerator* map = game->getMap();
+    Player* player = game->getPlayer();
+    if (!map || !player) return;
+
+    if (!built || builtGeneration != map->getGeneration()) {
+        rebuild(*map);
+    }
+
+    float worldToMap = (float)width / (map->getMapWidth() * map->getTileSize());
+
+    const FieldOfView& fov = game->getFieldOfView();
+    updateMask(fov, map->getMapWidth(), map->getMapHeight());
+
+    // Cached layers: two blits
+    Rectangle source = {0.0f, 0.0f, (float)width, -(float)height};
+    DrawTextureRec(tileLayer.texture, source, Vector2{(float)x, (float)y}, WHITE);
+
+    float cellSize = (float)width / map->getMapWidth();
+    Rectangle maskSource = {0.0f, 0.0f, (float)exploredMask.width, (float)exploredMask.height};
+    Rectangle maskDest = {(float)x, (float)y, exploredMask.width * cellSize, exploredMask.height * cellSize};
+    DrawTexturePro(exploredMask, maskSource, maskDest, Vector2{0, 0}, 0.0f, WHITE);
+
+    // Dynamic markers in one batch
+    auto toMiniMap = [&](Vector2 worldPos) {
+        return Vector2{x + worldPos.x * worldToMap, y + worldPos.y * worldToMap};
+    };
+    auto inside = [&](Vector2 p) {
+        return p.x >= x && p.x < x + width && p.y >= y && p.y < y + height;
+    };
+
+    QuadBatch::begin();
+
+    for (const auto& enemy : game->getEnemies()) {
+        if (!enemy->getIsAlive() || !enemy->isInPlayerView()) continue;
+
+        Vector2 marker = toMiniMap(enemy->getPosition());
+        if (inside(marker)) QuadBatch::addCircle(marker, 2.0f, Color{230, 41, 55, 255});
+    }
+
+    CompanionSystem& companions = game->getCompanionSystem();
+    if (companions.hasActiveCompanion() && companions.getCompanion()->getIsAlive()) {
+        Vector2 marker = toMiniMap(companions.getCompanion()->getPosition());
+        if (inside(marker)) QuadBatch::addCircle(marker, 2.0f, Color{0, 228, 48, 255});
+    }
+
+    Vector2 marker = toMiniMap(player->getPosition());
+    if (inside(marker)) {
+        QuadBatch::addCircle(marker, 3.0f, Color{0, 121, 241, 255});
+        QuadBatch::addCircle(marker, 2.0f, Color{255, 255, 255, 255});
+    }
+
+    QuadBatch::end();
+}
@@ -0,0 +1,118 @@
+#include "TextAtlas.h"
+#include <iostream>
+
+RenderTexture2D TextAtlas::atlas = {};
+bool TextAtlas::ready = false;
+std::vector<TextAtlas::Label> TextAtlas::labels;
+std::unordered_map<std::string, int> TextAtlas::labelIds;
+int TextAtlas::cursorX = 0;
+int TextAtlas::cursorY = 0;
+int TextAtlas::rowHeight = 0;
+int TextAtlas::digitIds[10] = {};
+int TextAtlas::minusId = -1;
+
+void TextAtlas::initialize() {
+    if (ready) shutdown();
+
+    atlas = LoadRenderTexture(ATLAS_SIZE, ATLAS_SIZE);
+    if (atlas.id == 0) {
+        std::cout << "Warning: Could not create text atlas, falling back to DrawText" << std::endl;
+        return;
+    }
+
+    BeginTextureMode(atlas);
+    ClearBackground(BLANK);
+    EndTextureMode();
+    ready = true;
+
+    const char digits[] = "0123456789";
+    for (int i = 0; i < 10; i++) {
+        digitIds[i] = registerLabel(std::string(1, digits[i]), DIGIT_FONT_SIZE);
+    }
+    minusId = registerLabel("-", DIGIT_FONT_SIZE);
+}
+
+void TextAtlas::shutdown() {
+    if (atlas.id != 0) {
+        UnloadRenderTexture(atlas);
+    }
+    atlas = {};
+    ready = false;
+    labels.clear();
+    labelIds.clear();
+    cursorX = cursorY = rowHeight = 0;
+    minusId = -1;
+}
+
+int TextAtlas::registerLabel(const std::string& text, int fontSize) {
+    if (!ready) return -1;
+
+    std::string key = std::to_string(fontSize) + ":" + text;
+    auto existing = labelIds.find(key);
+    if (existing != labelIds.end()) return existing->second;
+
+    int width = MeasureText(text.c_str(), fontSize);
+    int height = fontSize;
+
+    // Shelf packing: fill rows left to right, start a new row when full
+    if (cursorX + width > ATLAS_SIZE) {
+        cursorX = 0;
+        cursorY += rowHeight + 1;
+        rowHeight = 0;
+    }
+    if (width > ATLAS_SIZE || cursorY + height > ATLAS_SIZE) {
+        return -1;
+    }
+
+    // Must be called outside BeginMode2D, since texture mode resets the camera
+    BeginTextureMode(atlas);
+    DrawText(text.c_str(), cursorX, cursorY, fontSize, WHITE);
+    EndTextureMode();
+
+    // Render textures are stored bottom-up, so flip the source rectangle
+    Label label;
+    label.source = {(float)cursorX, (float)(ATLAS_SIZE - cursorY - height), (float)width, (float)-height};
+    label.width = width;
+    label.height = height;
+
+    int id = (int)labels.size();
+    labels.push_back(label);
+    labelIds[key] = id;
+
+    cursorX += width + 1;
+    if (height > rowHeight) rowHeight = height;
+
+    return id;
+}
+
+void TextAtlas::drawLabel(int labelId, Vector2 position, Color tint) {
+    if (!ready || labelId < 0 || labelId >= (int)labels.size()) return;
+    DrawTextureRec(atlas.texture, labels[labelId].source, position, tint);
+}
+
+void TextAtlas::drawNegativeNumber(int value, Vector2 position, Color tint) {
+    if (value < 0) value = -value;
+
+    int digits[12];
+    int digitCount = 0;
+    do {
+        digits[digitCount++] = value % 10;
+        value /= 10;
+    } while (value > 0 && digitCount < 12);
+
+    // Same glyph spacing DrawText uses for the default font
+    float spacing = (float)(DIGIT_FONT_SIZE / 10);
+    float x = position.x;
+
+    if (minusId >= 0) {
+        drawLabel(minusId, {x, position.y}, tint);
+        x += labels[minusId].width + spacing;
+    }
+
+    for (int i = digitCount - 1; i >= 0; i--) {
+        int id = digitIds[digits[i]];
+        if (id < 0) continue;
+        drawLabel(id, {x, position.y}, tint);
+        x += labels[id].width + spacing;
+    }
+}
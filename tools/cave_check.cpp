@@ -0,0 +1,163 @@
+// Checks for the cellular-automaton cave generator. Each bit-parallel
+// smoothing step is compared with a plain count of the 9 tiles around each
+// tile, on widths that don't fill whole 64-bit words. Finished caves must be
+// one connected open region. Exits non-zero if any check fails.
+// Usage: cave_check
+#include "CaveGenerator.h"
+#include "Config.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    int failures = 0;
+
+    void check(bool ok, const std::string& what) {
+        std::cout << (ok ? "  ok    " : "  FAIL  ") << what << std::endl;
+        if (!ok) failures++;
+    }
+
+    std::vector<uint8_t> copyWalls(const CaveGenerator& caves, int width, int height) {
+        std::vector<uint8_t> grid((size_t)width * height);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) grid[(size_t)y * width + x] = caves.isWall(x, y);
+        }
+        return grid;
+    }
+
+    // One smoothing step, one tile at a time: wall when at least 5 of the 9
+    // tiles around and including it are walls, outside the grid counting as
+    // wall, and the border always wall
+    std::vector<uint8_t> smoothReference(const std::vector<uint8_t>& grid, int width, int height) {
+        std::vector<uint8_t> next(grid.size());
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                int walls = 0;
+                for (int oy = -1; oy <= 1; oy++) {
+                    for (int ox = -1; ox <= 1; ox++) {
+                        int nx = x + ox;
+                        int ny = y + oy;
+                        bool outside = nx < 0 || ny < 0 || nx >= width || ny >= height;
+                        walls += outside ? 1 : grid[(size_t)ny * width + nx];
+                    }
+                }
+                bool border = x == 0 || y == 0 || x == width - 1 || y == height - 1;
+                next[(size_t)y * width + x] = walls >= 5 || border;
+            }
+        }
+        return next;
+    }
+
+    bool smoothMatchesReference(int width, int height, uint32_t seed, int steps) {
+        CaveGenerator caves(width, height);
+        std::mt19937 rng(seed);
+        caves.randomFill(rng);
+
+        std::vector<uint8_t> expected = copyWalls(caves, width, height);
+        for (int step = 0; step < steps; step++) {
+            caves.smooth();
+            expected = smoothReference(expected, width, height);
+            if (copyWalls(caves, width, height) != expected) return false;
+        }
+        return true;
+    }
+
+    int countOpenRegions(const CaveGenerator& caves, int width, int height) {
+        std::vector<uint8_t> seen((size_t)width * height, 0);
+        std::vector<int> stack;
+        int regions = 0;
+
+        for (int start = 0; start < width * height; start++) {
+            if (seen[start] || caves.isWall(start % width, start / width)) continue;
+            regions++;
+            seen[start] = 1;
+            stack.push_back(start);
+
+            while (!stack.empty()) {
+                int tile = stack.back();
+                stack.pop_back();
+                const int x = tile % width;
+                const int y = tile / width;
+                const int neighbours[4][2] = {{x + 1, y}, {x - 1, y}, {x, y + 1}, {x, y - 1}};
+                for (const auto& n : neighbours) {
+                    if (caves.isWall(n[0], n[1])) continue;
+                    int index = n[1] * width + n[0];
+                    if (!seen[index]) {
+                        seen[index] = 1;
+                        stack.push_back(index);
+                    }
+                }
+            }
+        }
+        return regions;
+    }
+
+    void testSmoothing() {
+        std::cout << "smoothing step against the 9-tile count" << std::endl;
+        const int sizes[][2] = {{63, 40}, {64, 64}, {65, 33}, {80, 50}, {127, 31}, {130, 70}};
+        for (const auto& size : sizes) {
+            bool ok = true;
+            for (uint32_t seed = 1; seed <= 8; seed++) {
+                ok = ok && smoothMatchesReference(size[0], size[1], seed, Config::CAVE_SMOOTHING_STEPS + 2);
+            }
+            check(ok, std::to_string(size[0]) + "x" + std::to_string(size[1]) + " matches for 8 seeds");
+        }
+    }
+
+    void testConnectivity() {
+        std::cout << "finished caves are one open region" << std::endl;
+        const int sizes[][2] = {{63, 40}, {65, 33}, {80, 50}, {130, 70}, {256, 256}};
+        for (const auto& size : sizes) {
+            bool ok = true;
+            for (uint32_t seed = 1; seed <= 8; seed++) {
+                CaveGenerator caves(size[0], size[1]);
+                std::mt19937 rng(seed);
+                caves.generate(rng, Config::CAVE_SMOOTHING_STEPS);
+                ok = ok && countOpenRegions(caves, size[0], size[1]) == 1;
+            }
+            check(ok, std::to_string(size[0]) + "x" + std::to_string(size[1]) + " connected for 8 seeds");
+        }
+    }
+
+    void timeLargeCave() {
+        const int size = 1024;
+        double best = 0;
+        int regions = 0, linked = 0;
+        bool connected = true;
+
+        for (uint32_t seed = 1; seed <= 3; seed++) {
+            CaveGenerator caves(size, size);
+            std::mt19937 rng(seed);
+            Clock::time_point start = Clock::now();
+            caves.generate(rng, Config::CAVE_SMOOTHING_STEPS);
+            double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+            if (seed == 1 || elapsed < best) best = elapsed;
+            regions = caves.getRegionCount();
+            linked = caves.getLinkedCount();
+            connected = connected && countOpenRegions(caves, size, size) == 1;
+        }
+
+        std::cout << size << "x" << size << " cave: " << best << " ms (best of 3), " << regions
+                  << " open regions, " << linked << " tunnelled" << std::endl;
+        check(connected, "1024x1024 connected for 3 seeds");
+    }
+}
+
+int main() {
+    testSmoothing();
+    testConnectivity();
+    timeLargeCave();
+
+    if (failures > 0) {
+        std::cout << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,177 @@
+// JSON save loading benchmark: SaveData::fromJSON against the line-scan
+// loader it replaced, on exports of about 2 KB (a typical save), 49 KB and
+// 245 KB, the larger ones padded out with long inventories. Both load the
+// same file from disk each time; the old loader ignores the inventory.
+// Usage: json_bench [loads] [scratch directory]
+#include "SaveSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double millisecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // SaveData::fromJSON from before JsonReader, which matched each line
+    // against the exact layout toJSON writes
+    bool legacyFromJSON(SaveData& data, const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.find("playerName") != std::string::npos) {
+                size_t start = line.find('"', line.find(':'));
+                size_t end = line.find('"', start + 1);
+                if (start != std::string::npos && end != std::string::npos) {
+                    data.playerName = line.substr(start + 1, end - start - 1);
+                }
+            } else if (line.find("playerLevel") != std::string::npos) {
+                sscanf(line.c_str(), "  \"playerLevel\": %d,", &data.playerLevel);
+            } else if (line.find("playerHealth") != std::string::npos && line.find("Max") == std::string::npos) {
+                sscanf(line.c_str(), "  \"playerHealth\": %d,", &data.playerHealth);
+            } else if (line.find("playerMaxHealth") != std::string::npos) {
+                sscanf(line.c_str(), "  \"playerMaxHealth\": %d,", &data.playerMaxHealth);
+            } else if (line.find("playerExperience") != std::string::npos) {
+                sscanf(line.c_str(), "  \"playerExperience\": %d,", &data.playerExperience);
+            } else if (line.find("score") != std::string::npos && line.find("playTime") == std::string::npos) {
+                sscanf(line.c_str(), "  \"score\": %d,", &data.score);
+            } else if (line.find("enemiesKilled") != std::string::npos) {
+                sscanf(line.c_str(), "  \"enemiesKilled\": %d,", &data.enemiesKilled);
+            } else if (line.find("currentFloor") != std::string::npos) {
+                sscanf(line.c_str(), "  \"currentFloor\": %d,", &data.currentFloor);
+            } else if (line.find("playTime") != std::string::npos) {
+                sscanf(line.c_str(), "  \"playTime\": %f,", &data.playTime);
+            } else if (line.find("\"health\"") != std::string::npos) {
+                sscanf(line.c_str(), "    \"health\": %d,", &data.potions.healthPotions);
+            } else if (line.find("\"speed\"") != std::string::npos) {
+                sscanf(line.c_str(), "    \"speed\": %d,", &data.potions.speedPotions);
+            } else if (line.find("\"stealth\"") != std::string::npos) {
+                sscanf(line.c_str(), "    \"stealth\": %d,", &data.potions.stealthPotions);
+            } else if (line.find("\"rage\"") != std::string::npos) {
+                sscanf(line.c_str(), "    \"rage\": %d,", &data.potions.ragePotions);
+            } else if (line.find("\"mana\"") != std::string::npos) {
+                sscanf(line.c_str(), "    \"mana\": %d", &data.potions.manaPotions);
+            } else if (line.find("totalDamageDealt") != std::string::npos) {
+                sscanf(line.c_str(), "  \"totalDamageDealt\": %d,", &data.totalDamageDealt);
+            } else if (line.find("totalDamageTaken") != std::string::npos) {
+                sscanf(line.c_str(), "  \"totalDamageTaken\": %d,", &data.totalDamageTaken);
+            } else if (line.find("highestFloor") != std::string::npos) {
+                sscanf(line.c_str(), "  \"highestFloor\": %d,", &data.highestFloor);
+            } else if (line.find("exploredFloor") != std::string::npos) {
+                sscanf(line.c_str(), "  \"exploredFloor\": %d,", &data.exploredFloor);
+            } else if (line.find("exploredTiles") != std::string::npos) {
+                size_t start = line.find('"', line.find(':'));
+                size_t end = line.find('"', start + 1);
+                if (start != std::string::npos && end != std::string::npos) {
+                    data.exploredTiles = line.substr(start + 1, end - start - 1);
+                }
+            }
+        }
+
+        file.close();
+        std::cout << "Game loaded from " << filename << std::endl;
+        return true;
+    }
+
+    SaveData makeSave(int items) {
+        SaveData data;
+        data.playerName = "Bench";
+        data.playerLevel = 14;
+        data.playerHealth = 180;
+        data.playerMaxHealth = 240;
+        data.playerExperience = 3120;
+        data.score = 48210;
+        data.enemiesKilled = 233;
+        data.currentFloor = 12;
+        data.playTime = 5421.75f;
+        data.currentWeapon = "Frost Axe";
+        data.potions = {4, 2, 1, 3, 5};
+        data.totalDamageDealt = 51234;
+        data.totalDamageTaken = 20871;
+        data.potionsUsed = 61;
+        data.highestFloor = 12;
+        data.exploredFloor = 12;
+        data.exploredTiles = std::string(1000, 'f');  // One bit per tile of an 80x50 floor
+        data.lastSaveTime = "Sun Oct 18 12:00:00 2026";
+        for (int i = 0; i < items; i++) {
+            data.inventory.push_back({"Silver Ring #" + std::to_string(i), 1 + i % 5});
+        }
+        return data;
+    }
+
+    // Milliseconds per load, best of five batches, with the loaders'
+    // "Game loaded" lines discarded
+    template <typename Load>
+    double timeLoads(Load load, int loads) {
+        std::ostringstream sink;
+        std::streambuf* console = std::cout.rdbuf(sink.rdbuf());
+        double best = 0;
+        for (int batch = 0; batch < 5; batch++) {
+            Clock::time_point start = Clock::now();
+            for (int i = 0; i < loads; i++) load();
+            double elapsed = millisecondsSince(start) / loads;
+            if (batch == 0 || elapsed < best) best = elapsed;
+            sink.str("");
+        }
+        std::cout.rdbuf(console);
+        return best;
+    }
+}
+
+int main(int argc, char** argv) {
+    const int loads = argc > 1 ? std::atoi(argv[1]) : 2000;
+    std::filesystem::path dir = argc > 2 ? std::filesystem::path(argv[2])
+                                         : std::filesystem::temp_directory_path() / "json_bench";
+    if (loads <= 0) {
+        std::cerr << "Usage: json_bench [loads] [scratch directory]" << std::endl;
+        return 1;
+    }
+    std::error_code error;
+    std::filesystem::create_directories(dir, error);
+    if (error) {
+        std::cerr << "Could not create " << dir.string() << ": " << error.message() << std::endl;
+        return 1;
+    }
+
+    const int inventorySizes[] = {10, 1000, 5000};
+    for (int items : inventorySizes) {
+        std::string file = (dir / ("save_" + std::to_string(items) + ".json")).string();
+        if (!SaveSystem::exportJSON(makeSave(items), file)) {
+            std::cerr << "Could not write " << file << std::endl;
+            return 1;
+        }
+
+        // `loads` is for the 2 KB save; bigger files get proportionally fewer
+        const auto bytes = std::filesystem::file_size(file);
+        const int runs = std::max(10, (int)((double)loads * 2048 / bytes));
+        SaveData legacy, parsed;
+        double legacyTime = timeLoads([&] { legacy = SaveData(); legacyFromJSON(legacy, file); }, runs);
+        double parseTime = timeLoads([&] { parsed = SaveData(); parsed.fromJSON(file); }, runs);
+
+        std::cout << items << " items, " << (bytes + 512) / 1024 << " KB, " << runs
+                  << " loads" << std::endl;
+        std::cout << "  line scan: " << legacyTime * 1000.0 << " us/load" << std::endl;
+        std::cout << "  parseJSON: " << parseTime * 1000.0 << " us/load, " << parsed.inventory.size()
+                  << " items read" << std::endl;
+        if (legacy.score != parsed.score || legacy.exploredTiles != parsed.exploredTiles) {
+            std::cerr << "  loaders disagree on " << file << std::endl;
+            return 1;
+        }
+    }
+
+    std::filesystem::remove_all(dir, error);
+    return 0;
+}
@@ -0,0 +1,66 @@
+// Room layout microbenchmark: the BSP split and the MST/corridor pass timed
+// apart on maps from the standard 80x50 up to 2560x1600. Room counts are the
+// ones generateFloor rolls for a ROOMS floor, so they grow with map area.
+// Every run lays out the same seed; each phase reports its best run.
+// Usage: mapgen_bench [floor] [runs]
+#include "MapGenerator.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    double millisecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+}
+
+int main(int argc, char** argv) {
+    const int floorNumber = argc > 1 ? std::atoi(argv[1]) : 20;
+    const int runs = argc > 2 ? std::atoi(argv[2]) : 5;
+    if (floorNumber <= 0 || runs <= 0) {
+        std::cerr << "Usage: mapgen_bench [floor] [runs]" << std::endl;
+        return 1;
+    }
+
+    const int sizes[][2] = {{80, 50}, {160, 100}, {320, 200}, {640, 400}, {1280, 800}, {2560, 1600}};
+    std::cout << "Floor " << floorNumber << " room layout, best of " << runs << std::endl;
+
+    for (const auto& size : sizes) {
+        MapGenerator map(size[0], size[1], Config::TILE_SIZE);
+        double bestSplit = 0, bestConnect = 0;
+        size_t rooms = 0;
+
+        for (int run = 0; run < runs; run++) {
+            map.beginFloor(12345);
+            int count = map.rollRoomCount(floorNumber);
+
+            Clock::time_point start = Clock::now();
+            std::vector<Room> regions = map.splitRegions(count);
+            double splitTime = millisecondsSince(start);
+
+            map.placeRooms(regions);
+
+            start = Clock::now();
+            map.connectRooms(regions);
+            double connectTime = millisecondsSince(start);
+
+            if (run == 0 || splitTime < bestSplit) bestSplit = splitTime;
+            if (run == 0 || connectTime < bestConnect) bestConnect = connectTime;
+            rooms = regions.size();
+        }
+
+        std::ostringstream label;
+        label << size[0] << "x" << size[1];
+        std::cout << "  " << label.str() << std::string(12 - label.str().size(), ' ') << rooms << " rooms"
+                  << "  BSP split " << bestSplit << " ms"
+                  << "  MST + corridors " << bestConnect << " ms"
+                  << "  (" << (bestSplit + bestConnect) * 1000.0 / rooms << " us/room)" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+// Particle update microbenchmark: the fixed-capacity SoA pool against the
+// vector<Particle> + erase loop it replaced, both held at 100k live particles.
+// Each frame updates every particle, then tops the system back up with
+// fresh ones, so about 1-2% die and respawn per frame.
+// Usage: particle_bench [particles] [frames]
+#include "ParticleSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr float FRAME_TIME = 1.0f / 60.0f;
+    constexpr int WARMUP_FRAMES = 120;  // Long enough for lifetimes to spread out
+
+    double millisecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // The particle storage and update loop from before the pool
+    struct LegacyParticle {
+        Vector2 position;
+        Vector2 velocity;
+        Color color;
+        float life;
+        float maxLife;
+        float size;
+
+        LegacyParticle(Vector2 pos, Vector2 vel, Color col, float lifetime, float sz)
+            : position(pos), velocity(vel), color(col), life(lifetime), maxLife(lifetime), size(sz) {}
+    };
+
+    class LegacyParticles {
+    private:
+        std::vector<LegacyParticle> particles;
+        std::mt19937 gen{12345};
+
+    public:
+        void addExplosion(Vector2 position, Color color, int amount) {
+            std::uniform_real_distribution<float> angleDist(0, 6.28f);
+            std::uniform_real_distribution<float> speedDist(50, 150);
+            std::uniform_real_distribution<float> lifeDist(0.5f, 1.5f);
+
+            for (int i = 0; i < amount; i++) {
+                float angle = angleDist(gen);
+                float speed = speedDist(gen);
+                Vector2 velocity = {std::cos(angle) * speed, std::sin(angle) * speed};
+                particles.emplace_back(position, velocity, color, lifeDist(gen), 3.0f + (float)(gen() % 3));
+            }
+        }
+
+        void update(float deltaTime) {
+            for (auto it = particles.begin(); it != particles.end();) {
+                it->life -= deltaTime;
+                it->position.x += it->velocity.x * deltaTime;
+                it->position.y += it->velocity.y * deltaTime;
+                it->velocity.y += 100 * deltaTime;
+                it->velocity.x *= 0.98f;
+                it->velocity.y *= 0.98f;
+                it->color.a = (unsigned char)(255 * (it->life / it->maxLife));
+
+                if (it->life <= 0) {
+                    it = particles.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        int getParticleCount() const { return (int)particles.size(); }
+    };
+
+    // Runs the steady-state loop and returns milliseconds per update
+    template <typename System>
+    double timeUpdates(System& system, int target, int frames) {
+        const Vector2 origin = {400.0f, 300.0f};
+        double updateTime = 0.0;
+
+        for (int frame = -WARMUP_FRAMES; frame < frames; frame++) {
+            Clock::time_point start = Clock::now();
+            system.update(FRAME_TIME);
+            if (frame >= 0) updateTime += millisecondsSince(start);
+
+            system.addExplosion(origin, ORANGE, target - system.getParticleCount());
+        }
+        return updateTime / frames;
+    }
+}
+
+int main(int argc, char** argv) {
+    const int target = argc > 1 ? std::atoi(argv[1]) : 100000;
+    const int frames = argc > 2 ? std::atoi(argv[2]) : 200;
+    if (target <= 0 || frames <= 0) {
+        std::cerr << "Usage: particle_bench [particles] [frames]" << std::endl;
+        return 1;
+    }
+
+    ParticleSystem pool(target);
+    Clock::time_point start = Clock::now();
+    pool.addExplosion(Vector2{400.0f, 300.0f}, ORANGE, target);
+    double emitTime = millisecondsSince(start);
+    pool.clear();
+
+    double poolTime = timeUpdates(pool, target, frames);
+
+    // The old loop is quadratic; a few frames are enough to see it
+    const int legacyFrames = std::max(1, frames / 20);
+    LegacyParticles legacy;
+    double legacyTime = timeUpdates(legacy, target, legacyFrames);
+
+    std::cout << target << " particles" << std::endl;
+    std::cout << "  vector<Particle> update: " << legacyTime << " ms/frame over " << legacyFrames << " frames" << std::endl;
+    std::cout << "  pool update:             " << poolTime << " ms/frame over " << frames << " frames" << std::endl;
+    std::cout << "  pool bulk emit:          " << emitTime << " ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,384 @@
+// Round-trip checks for the save file, its JSON export and the save journal,
+// plus what parseJSON rejects and skips. Writes into a scratch directory and
+// exits non-zero if any check fails.
+// Usage: save_roundtrip [scratch directory]
+#include "SaveSystem.h"
+#include "SaveJournal.h"
+#include "JsonReader.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace {
+    int failures = 0;
+
+    void check(bool ok, const std::string& what) {
+        std::cout << (ok ? "  ok    " : "  FAIL  ") << what << std::endl;
+        if (!ok) failures++;
+    }
+
+    bool readFile(const std::string& filename, std::string& bytes) {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) return false;
+        bytes.assign((std::size_t)file.tellg(), '\0');
+        file.seekg(0);
+        file.read(&bytes[0], (std::streamsize)bytes.size());
+        return true;
+    }
+
+    // Everything the JSON export carries, which is every field older saves had
+    bool sameLegacyFields(const SaveData& a, const SaveData& b) {
+        return a.playerName == b.playerName && a.playerLevel == b.playerLevel &&
+               a.playerHealth == b.playerHealth && a.playerMaxHealth == b.playerMaxHealth &&
+               a.playerExperience == b.playerExperience && a.score == b.score &&
+               a.enemiesKilled == b.enemiesKilled && a.currentFloor == b.currentFloor &&
+               a.playTime == b.playTime && a.currentWeapon == b.currentWeapon &&
+               a.potions.healthPotions == b.potions.healthPotions &&
+               a.potions.speedPotions == b.potions.speedPotions &&
+               a.potions.stealthPotions == b.potions.stealthPotions &&
+               a.potions.ragePotions == b.potions.ragePotions &&
+               a.potions.manaPotions == b.potions.manaPotions &&
+               a.totalDamageDealt == b.totalDamageDealt && a.totalDamageTaken == b.totalDamageTaken &&
+               a.potionsUsed == b.potionsUsed && a.highestFloor == b.highestFloor &&
+               a.exploredFloor == b.exploredFloor && a.exploredTiles == b.exploredTiles &&
+               a.lastSaveTime == b.lastSaveTime;
+    }
+
+    bool sameInventory(const SaveData& a, const SaveData& b) {
+        if (a.inventory.size() != b.inventory.size()) return false;
+        for (std::size_t i = 0; i < a.inventory.size(); i++) {
+            if (a.inventory[i].name != b.inventory[i].name || a.inventory[i].quantity != b.inventory[i].quantity) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool sameRunState(const SaveData& a, const SaveData& b) {
+        if (a.hasRunState != b.hasRunState || a.runSeed != b.runSeed || a.floorSeed != b.floorSeed ||
+            a.layoutChecksum != b.layoutChecksum || a.playerX != b.playerX || a.playerY != b.playerY ||
+            a.journalEpoch != b.journalEpoch || !sameInventory(a, b) || a.equippedItems != b.equippedItems ||
+            a.speedBuffTime != b.speedBuffTime || a.stealthBuffTime != b.stealthBuffTime ||
+            a.rageBuffTime != b.rageBuffTime || a.spells.size() != b.spells.size() ||
+            a.enemies.size() != b.enemies.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.spells.size(); i++) {
+            if (a.spells[i].type != b.spells[i].type || a.spells[i].sinceCast != b.spells[i].sinceCast) return false;
+        }
+        for (std::size_t i = 0; i < a.enemies.size(); i++) {
+            const SavedEnemy& x = a.enemies[i];
+            const SavedEnemy& y = b.enemies[i];
+            if (x.type != y.type || x.level != y.level || x.health != y.health || x.x != y.x || x.y != y.y) {
+                return false;
+            }
+        }
+        return a.companion.type == b.companion.type && a.companion.level == b.companion.level &&
+               a.companion.health == b.companion.health && a.companion.x == b.companion.x &&
+               a.companion.y == b.companion.y;
+    }
+
+    SaveData makeLegacySave() {
+        SaveData data;
+        data.playerName = "Round \"Trip\"\n";
+        data.playerLevel = 7;
+        data.playerHealth = 83;
+        data.playerMaxHealth = 140;
+        data.playerExperience = 455;
+        data.score = 12345;
+        data.enemiesKilled = 61;
+        data.currentFloor = 9;
+        data.playTime = 1234.5f;
+        data.currentWeapon = "Frost Axe";
+        data.potions = {3, 1, 2, 0, 4};
+        data.totalDamageDealt = 9876;
+        data.totalDamageTaken = 5432;
+        data.potionsUsed = 17;
+        data.highestFloor = 10;
+        data.exploredFloor = 9;
+        data.exploredTiles = "00ff3c0000a1";
+        data.lastSaveTime = "Sat Oct 17 12:00:00 2026";
+        return data;
+    }
+
+    SaveData makeFullSave() {
+        SaveData data = makeLegacySave();
+        data.hasRunState = true;
+        data.runSeed = 0xDEADBEEFu;
+        data.floorSeed = 0x01234567u;
+        data.layoutChecksum = 0x89ABCDEFu;
+        data.playerX = 612.25f;
+        data.playerY = 384.5f;
+        data.journalEpoch = 1;
+        data.inventory = {{"Health Potion", 3}, {"Speed Potion", 1}, {"Stealth Potion", 2}, {"Iron Ring", 1}};
+        data.equippedItems = {4, 9};
+        data.spells = {{0, 1.5f}, {2, 0.25f}};
+        data.speedBuffTime = 2.5f;
+        data.stealthBuffTime = 0.75f;
+        data.rageBuffTime = 4.0f;
+        data.enemies = {{1, 3, 40, 100.0f, 200.0f}, {2, 4, 55, 300.0f, 120.0f}, {1, 5, 70, 480.0f, 640.0f}};
+        data.companion = {2, 3, 60, 600.0f, 380.0f};
+        return data;
+    }
+
+    void testBinaryRoundTrip(const std::string& dir) {
+        std::cout << "binary save" << std::endl;
+        SaveData saved = makeFullSave();
+        std::string file = dir + "/full.dat";
+        check(SaveSystem::save(saved, file, file + ".bak"), "save writes");
+
+        SaveData loaded;
+        check(SaveSystem::load(loaded, file, file + ".bak"), "save reads back");
+        check(sameLegacyFields(saved, loaded), "player, progress, potion and statistics fields match");
+        check(sameRunState(saved, loaded), "run state, inventory, spells, buffs, enemies and companion match");
+
+        SaveSummary summary;
+        check(SaveSystem::readSummary(file, summary) && summary.playerName == saved.playerName &&
+              summary.level == saved.playerLevel && summary.floor == saved.currentFloor,
+              "summary header matches");
+    }
+
+    void testLegacySave(const std::string& dir) {
+        std::cout << "legacy save" << std::endl;
+
+        // Saves from before the run-state sections hold only these fields
+        SaveData saved = makeLegacySave();
+        std::string file = dir + "/legacy.dat";
+        check(SaveSystem::save(saved, file, file + ".bak"), "save writes");
+
+        SaveData loaded;
+        check(SaveSystem::load(loaded, file, file + ".bak"), "save reads back");
+        check(!loaded.hasRunState, "hasRunState is false");
+        check(sameLegacyFields(saved, loaded), "legacy fields match");
+        check(loaded.runSeed == 0 && loaded.journalEpoch == 0 && loaded.inventory.empty() &&
+              loaded.enemies.empty(), "run state keeps its defaults");
+        check(SaveJournal::replay(loaded, dir + "/none.journal", dir + "/none.journal.prev") == 0,
+              "no journal is replayed");
+
+        // Text saves from before the binary format
+        std::string text = dir + "/legacy.json";
+        std::ofstream(text) << "{\n  \"playerName\": \"Old\",\n  \"playerLevel\": 4,\n  \"score\": 900,\n"
+                               "  \"potions\": {\"health\": 2, \"rage\": 1}\n}\n";
+        SaveData old;
+        check(old.fromJSON(text) && !old.hasRunState && old.playerLevel == 4 && old.score == 900 &&
+              old.potions.healthPotions == 2 && old.potions.ragePotions == 1, "text save loads");
+    }
+
+    void testJsonExport(const std::string& dir) {
+        std::cout << "binary -> JSON -> parseJSON" << std::endl;
+        SaveData saved = makeFullSave();
+        std::string file = dir + "/export.dat";
+        std::string json = dir + "/export.json";
+
+        SaveData loaded;
+        check(SaveSystem::save(saved, file, file + ".bak") && SaveSystem::load(loaded, file, file + ".bak"),
+              "binary save reads back");
+        check(SaveSystem::exportJSON(loaded, json), "export writes");
+
+        std::string bytes, error;
+        SaveData parsed;
+        check(readFile(json, bytes) && parsed.parseJSON(bytes.data(), bytes.size(), &error), "export parses" + (error.empty() ? "" : ": " + error));
+        check(sameLegacyFields(saved, parsed), "legacy fields match");
+        check(sameInventory(saved, parsed), "inventory matches");
+        check(!parsed.hasRunState, "run state is not part of the export");
+    }
+
+    bool parses(SaveData& data, const std::string& json, std::string* error = nullptr) {
+        return data.parseJSON(json.data(), json.size(), error);
+    }
+
+    void testJsonRejects() {
+        std::cout << "parseJSON rejects malformed input" << std::endl;
+        const std::pair<std::string, const char*> cases[] = {
+            {"", "empty input"},
+            {"[1, 2]", "array at the top level"},
+            {"{\"score\": 5", "missing closing brace"},
+            {"{\"score\": 5,}", "trailing comma in an object"},
+            {"{\"dashboard\": [1, 2,]}", "trailing comma in an array"},
+            {"{\"score\" 5}", "missing colon"},
+            {"{'score': 5}", "single-quoted key"},
+            {"{\"playerName\": \"abc}", "unterminated string"},
+            {"{\"playerName\": \"a\nb\"}", "raw newline in a string"},
+            {"{\"score\": tru}", "misspelt literal"},
+            {"{\"score\": -}", "sign without digits"},
+            {"{\"score\": 1 2}", "two values for one key"},
+            {"{\"dashboard\": [1}", "mismatched bracket"},
+            {"{\"score\": 5}}", "extra closing brace"},
+            {"{} x", "data after the document"},
+            {"{\"dashboard\": " + std::string(40, '[') + std::string(40, ']') + "}", "nesting past 32 levels"},
+        };
+        for (const auto& [json, what] : cases) {
+            SaveData data;
+            std::string error;
+            bool rejected = !parses(data, json, &error) && !error.empty();
+            check(rejected, std::string(what) + " (" + error + ")");
+        }
+
+        // Errors name the line they were found on
+        SaveData data;
+        std::string error;
+        check(!parses(data, "{\n  \"score\": 5,\n  \"playerLevel\": }\n", &error) && error.rfind("3: ", 0) == 0,
+              "error reports line 3");
+    }
+
+    void testJsonSkips() {
+        std::cout << "parseJSON skips what it doesn't need" << std::endl;
+
+        SaveData data;
+        check(parses(data, "{\"score\":42,\"potions\":{\"mana\":3,\"health\":1},\"playerName\":\"Rex\",\"playerLevel\":6}") &&
+              data.score == 42 && data.potions.manaPotions == 3 && data.potions.healthPotions == 1 &&
+              data.playerName == "Rex" && data.playerLevel == 6,
+              "reordered, compact keys");
+
+        data = SaveData();
+        check(parses(data, "{\"dashboard\": {\"a\": [1, {\"b\": [[], {}]}, \"x\\\"}]\"], \"c\": null},\n"
+                           " \"score\": 7,\n"
+                           " \"extra\": [true, false, {\"d\": {\"score\": 99}}],\n"
+                           " \"playerLevel\": 3}") &&
+              data.score == 7 && data.playerLevel == 3,
+              "unknown keys with nested values are skipped whole");
+
+        data = SaveData();
+        check(parses(data, "{\"score\": \"high\", \"playerLevel\": [1, 2], \"potions\": {\"speed\": {\"x\": 1}, \"rage\": 2},"
+                           " \"enemiesKilled\": 4}") &&
+              data.score == 0 && data.playerLevel == 1 && data.potions.speedPotions == 0 &&
+              data.potions.ragePotions == 2 && data.enemiesKilled == 4,
+              "values of the wrong type keep their defaults");
+
+        // The reader on its own: skipValue after a key consumes the whole container
+        const std::string json = "{\"a\": {\"b\": [1, [2, {\"c\": 3}]]}, \"d\": 5}";
+        JsonReader reader(json.data(), json.size());
+        int value = 0;
+        bool ok = reader.next() == JsonToken::BEGIN_OBJECT && reader.next() == JsonToken::KEY &&
+                  reader.skipValue() && reader.getDepth() == 1 && reader.next() == JsonToken::KEY &&
+                  reader.getText() == "d" && reader.readInt(value) && value == 5 &&
+                  reader.next() == JsonToken::END_OBJECT && reader.next() == JsonToken::END;
+        check(ok, "JsonReader::skipValue lands on the next key");
+    }
+
+    struct JournalFiles {
+        std::string journal;
+        std::string previous;
+    };
+
+    JournalFiles resetJournal(const std::string& dir, const std::string& name) {
+        JournalFiles files{dir + "/" + name + ".journal", dir + "/" + name + ".journal.prev"};
+        std::error_code error;
+        std::filesystem::remove(files.journal, error);
+        std::filesystem::remove(files.previous, error);
+        return files;
+    }
+
+    void testJournal(const std::string& dir) {
+        std::cout << "save journal" << std::endl;
+        const SaveData snapshot = makeFullSave();  // journalEpoch 1
+
+        // Single journal continuing from the snapshot
+        JournalFiles files = resetJournal(dir, "single");
+        {
+            SaveJournal journal;
+            journal.setFiles(files.journal, files.previous);
+            check(journal.rotate(1), "journal opens");
+            journal.recordKill(2, 1, 310.0f, 125.0f, 12500, 62, 470);
+            journal.recordLevel(8, 10);
+            journal.recordItem("Speed Potion", 0);
+            journal.recordItem("Rage Potion", 2);
+            journal.recordFloor(10, 77, 0x5555u, 64.0f, 96.0f);
+        }
+        SaveData data = snapshot;
+        check(SaveJournal::replay(data, files.journal, files.previous) == 5, "all five events replay");
+        check(data.score == 12500 && data.enemiesKilled == 62 && data.playerLevel == 8 &&
+              data.playerExperience == 10, "kill and level applied");
+        check(data.potions.speedPotions == 0 && data.potions.ragePotions == 2 && data.inventory.size() == 4,
+              "item changes applied");
+        check(data.currentFloor == 10 && data.floorSeed == 77 && data.layoutChecksum == 0x5555u &&
+              data.playerX == 64.0f && data.playerY == 96.0f && data.highestFloor == 10 &&
+              data.enemies.empty() && data.exploredTiles.empty(), "floor change applied");
+        check(data.journalEpoch == 1, "epoch unchanged");
+
+        // Kills name the snapshot enemy that died, not the first of its type;
+        // an enemy spawned after the snapshot removes nothing
+        JournalFiles killFiles = resetJournal(dir, "kill");
+        {
+            SaveJournal journal;
+            journal.setFiles(killFiles.journal, killFiles.previous);
+            journal.rotate(1);
+            journal.recordKill(1, 2, 470.0f, 610.0f, 12400, 62, 465);
+            journal.recordKill(1, -1, 90.0f, 210.0f, 12500, 63, 490);
+        }
+        data = snapshot;
+        check(SaveJournal::replay(data, killFiles.journal, killFiles.previous) == 2 && data.enemies.size() == 2 &&
+              data.enemies[0].x == 100.0f && data.enemies[1].type == 2, "kill removes the enemy that died");
+
+        // Torn tail: the last record lost its final bytes in a crash
+        std::string bytes;
+        readFile(files.journal, bytes);
+        std::ofstream(files.journal, std::ios::binary).write(bytes.data(), (std::streamsize)bytes.size() - 3);
+        data = snapshot;
+        check(SaveJournal::replay(data, files.journal, files.previous) == 4, "torn record is dropped");
+        check(data.currentFloor == snapshot.currentFloor && data.potions.ragePotions == 2,
+              "events before the torn record applied");
+
+        // Previous + current: the snapshot that started epoch 2 never landed
+        files = resetJournal(dir, "rotated");
+        {
+            SaveJournal journal;
+            journal.setFiles(files.journal, files.previous);
+            journal.rotate(1);
+            journal.recordLevel(8, 20);
+            journal.recordKill(2, 1, 310.0f, 125.0f, 12500, 62, 470);
+            check(journal.rotate(2), "journal rotates");
+            journal.recordItem("Iron Ring", 0);
+            journal.recordLevel(9, 5);
+            // Index 0 of the lost epoch 2 snapshot; the position identifies it
+            journal.recordKill(1, 0, 470.0f, 630.0f, 12600, 63, 30);
+        }
+        data = snapshot;
+        check(SaveJournal::replay(data, files.journal, files.previous) == 5, "both journals replay");
+        check(data.playerLevel == 9 && data.playerExperience == 30 && data.inventory.size() == 3 &&
+              data.journalEpoch == 2, "events applied in order and epoch advanced");
+        check(data.enemies.size() == 1 && data.enemies[0].x == 100.0f,
+              "kills after the lost snapshot match by position");
+
+        // The epoch 2 snapshot did land: only the current journal continues it
+        data = snapshot;
+        data.journalEpoch = 2;
+        check(SaveJournal::replay(data, files.journal, files.previous) == 3 && data.playerLevel == 9,
+              "previous journal skipped for a newer snapshot");
+
+        // Stale: neither journal continues from this snapshot
+        data = snapshot;
+        data.journalEpoch = 5;
+        check(SaveJournal::replay(data, files.journal, files.previous) == 0 &&
+              data.playerLevel == snapshot.playerLevel && data.journalEpoch == 5, "stale journals ignored");
+    }
+}
+
+int main(int argc, char** argv) {
+    std::filesystem::path dir = argc > 1 ? std::filesystem::path(argv[1])
+                                         : std::filesystem::temp_directory_path() / "save_roundtrip";
+    std::error_code error;
+    std::filesystem::create_directories(dir, error);
+    if (error) {
+        std::cerr << "Could not create " << dir.string() << ": " << error.message() << std::endl;
+        return 1;
+    }
+
+    testBinaryRoundTrip(dir.string());
+    testLegacySave(dir.string());
+    testJsonExport(dir.string());
+    testJsonRejects();
+    testJsonSkips();
+    testJournal(dir.string());
+
+    std::filesystem::remove_all(dir, error);
+    if (failures > 0) {
+        std::cout << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,29 @@
+// Converts a binary save into the JSON format the web dashboard reads.
+// Usage: save_to_json <save.dat> [output.json]
+#include "SaveSystem.h"
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: save_to_json <save.dat> [output.json]" << std::endl;
+        return 1;
+    }
+
+    std::string input = argv[1];
+    std::string output = argc > 2 ? argv[2] : input.substr(0, input.find_last_of('.')) + ".json";
+
+    // No separate backup when converting a single file
+    SaveData data;
+    if (!SaveSystem::load(data, input, input)) {
+        std::cerr << "Could not read save: " << input << std::endl;
+        return 1;
+    }
+
+    if (!SaveSystem::exportJSON(data, output)) {
+        return 1;
+    }
+
+    std::cout << "Wrote " << output << std::endl;
+    return 0;
+}